@@ -0,0 +1,634 @@
+/*******************************************************************************
+* @file  rsi_host_stack_benchmark.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+
+/*================================================================================
+ * @brief : This file contains example application for measuring host stack cost
+ * @section Description :
+ * The application runs the SAPI driver against the simulated module of the
+ * Linux platform. It connects, opens a TCP client socket and sends data that
+ * the module echoes back, then reports host CPU time spent per byte. Since the
+ * module costs next to nothing, the figures track the host stack itself and
+ * can be compared between builds.
+ =================================================================================*/
+
+/**
+ * Include files
+ * */
+//! include file to refer data types
+#include "rsi_data_types.h"
+
+//! COMMON include file to refer wlan APIs
+#include "rsi_common_apis.h"
+
+//! WLAN include file to refer wlan APIs
+#include "rsi_wlan_apis.h"
+#include "rsi_wlan_non_rom.h"
+
+//! socket include file to refer socket APIs
+#include "rsi_socket.h"
+
+#include "rsi_bootup_config.h"
+//! Error include files
+#include "rsi_error.h"
+
+//! OS include file to refer OS specific functionality
+#include "rsi_os.h"
+#include "rsi_utils.h"
+#include "rsi_driver.h"
+
+//! Simulated module statistics
+#include "rsi_sim.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+//! configurattion Parameters
+
+//! Access point SSID to connect
+#define SSID "SILABS_AP"
+
+//! Security type
+#define SECURITY_TYPE RSI_OPEN
+
+//! Password
+#define PSK NULL
+
+//! Server port number
+#define SERVER_PORT 5001
+
+//! Server IP address, echoed by simulated module
+//! E.g: 0x640AA8C0 == 192.168.10.100
+#define SERVER_IP_ADDRESS 0x640AA8C0
+
+//! Bytes sent and echoed back per iteration
+#ifndef BENCHMARK_BUFFER_LEN
+#define BENCHMARK_BUFFER_LEN 4096
+#endif
+
+//! Largest message handed to rsi_send, TCP MSS. Larger values need LARGE_DATA_SYNC
+#ifndef BENCHMARK_SEND_LEN
+#define BENCHMARK_SEND_LEN 1460
+#endif
+
+//! Largest length handed to rsi_recv, smaller values mimic protocol parsers reading headers
+#ifndef BENCHMARK_RECV_LEN
+#define BENCHMARK_RECV_LEN BENCHMARK_BUFFER_LEN
+#endif
+
+//! Number of send/receive iterations
+#ifndef BENCHMARK_ITERATIONS
+#define BENCHMARK_ITERATIONS 1000
+#endif
+
+//! Wait for socket readiness with rsi_select before each send and receive
+#ifndef BENCHMARK_SELECT
+#define BENCHMARK_SELECT 0
+#endif
+
+//! Wait for socket readiness with rsi_epoll_wait before each send and receive
+#ifndef BENCHMARK_EPOLL
+#define BENCHMARK_EPOLL 0
+#endif
+
+//! Send and receive with rsi_sendmsg/rsi_recvmsg, each message split into a header and a payload buffer
+#ifndef BENCHMARK_MSG
+#define BENCHMARK_MSG 0
+#endif
+
+//! Length of header buffer of a message
+#define BENCHMARK_MSG_HEADER_LEN 8
+
+//! Number of UDP datagrams handed to one rsi_sendmmsg call, 0 skips the UDP send run
+#ifndef BENCHMARK_UDP_BATCH
+#define BENCHMARK_UDP_BATCH 0
+#endif
+
+//! Length of a UDP datagram, like a small sensor report
+#ifndef BENCHMARK_UDP_LEN
+#define BENCHMARK_UDP_LEN 100
+#endif
+
+//! Set to 1 to measure the cost of scheduler event dispatch first, bare metal build only
+#ifndef BENCHMARK_DISPATCH
+#define BENCHMARK_DISPATCH 0
+#endif
+
+//! Number of scheduler runs measured, each dispatching every driver event
+#ifndef BENCHMARK_DISPATCH_ITERATIONS
+#define BENCHMARK_DISPATCH_ITERATIONS 100000
+#endif
+
+#if (BENCHMARK_DISPATCH && (defined RSI_WITH_OS))
+#error "BENCHMARK_DISPATCH needs the bare metal build, the driver task would dispatch events meanwhile"
+#endif
+
+//! Memory length for driver, host receive rings included
+#define GLOBAL_BUFF_LEN (15000 + RSI_SOCKET_RX_RING_POOL_SIZE)
+
+//! Wlan task priority
+#define RSI_WLAN_TASK_PRIORITY 1
+
+//! Wireless driver task priority
+#define RSI_DRIVER_TASK_PRIORITY 2
+
+//! Wlan task stack size
+#define RSI_WLAN_TASK_STACK_SIZE 500
+
+//! Wireless driver task stack size
+#define RSI_DRIVER_TASK_STACK_SIZE 500
+
+//! Memory to initialize driver
+uint8_t global_buf[GLOBAL_BUFF_LEN];
+
+//! Data sent and received
+static uint8_t send_buffer[BENCHMARK_BUFFER_LEN];
+static uint8_t recv_buffer[BENCHMARK_BUFFER_LEN];
+
+#if BENCHMARK_MSG
+//! Send or receive one message at buffer, split into header and payload
+static int32_t benchmark_msg(int32_t sock_id, uint8_t *buffer, int32_t length, uint8_t send)
+{
+  struct rsi_iovec iov[2];
+  struct rsi_msghdr msg;
+
+  iov[0].iov_base = buffer;
+  iov[0].iov_len  = RSI_MIN(BENCHMARK_MSG_HEADER_LEN, length);
+  iov[1].iov_base = buffer + iov[0].iov_len;
+  iov[1].iov_len  = length - iov[0].iov_len;
+
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov    = iov;
+  msg.msg_iovlen = 2;
+
+  return send ? rsi_sendmsg(sock_id, &msg, 0) : rsi_recvmsg(sock_id, &msg, 0);
+}
+#endif
+
+//! Time elapsed between two readings of a clock, in nano seconds
+static uint64_t benchmark_elapsed_ns(const struct timespec *start, const struct timespec *end)
+{
+  return ((uint64_t)(end->tv_sec - start->tv_sec) * 1000000000ULL) + end->tv_nsec - start->tv_nsec;
+}
+
+#if BENCHMARK_DISPATCH
+//! Number of events dispatched to benchmark handlers
+static uint32_t benchmark_dispatched;
+
+//! Benchmark handlers, each clears its event like driver handlers do once done
+static void benchmark_tx_event_handler(void)
+{
+  benchmark_dispatched++;
+  rsi_clear_event(RSI_TX_EVENT);
+}
+
+static void benchmark_rx_event_handler(void)
+{
+  benchmark_dispatched++;
+  rsi_clear_event(RSI_RX_EVENT);
+}
+
+static void benchmark_socket_event_handler(void)
+{
+  benchmark_dispatched++;
+  rsi_clear_event(RSI_SOCKET_EVENT);
+}
+
+//! Measure scheduler cost per dispatched event, driver event handlers are swapped for benchmark ones meanwhile
+static int32_t benchmark_dispatch(void)
+{
+  rsi_event_cb_t saved_events[RSI_MAX_NUM_EVENTS];
+  rsi_scheduler_cb_t *scheduler_cb = &rsi_driver_cb->scheduler_cb;
+  struct timespec cpu_start, cpu_end;
+  uint64_t cpu_ns;
+  uint32_t iteration;
+  uint32_t event_map = BIT(RSI_TX_EVENT) | BIT(RSI_RX_EVENT) | BIT(RSI_SOCKET_EVENT);
+
+  memcpy(saved_events, rsi_driver_cb->event_list, sizeof(saved_events));
+  rsi_driver_cb->event_list[RSI_TX_EVENT].event_handler     = benchmark_tx_event_handler;
+  rsi_driver_cb->event_list[RSI_RX_EVENT].event_handler     = benchmark_rx_event_handler;
+  rsi_driver_cb->event_list[RSI_SOCKET_EVENT].event_handler = benchmark_socket_event_handler;
+  benchmark_dispatched                                       = 0;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+
+  for (iteration = 0; iteration < BENCHMARK_DISPATCH_ITERATIONS; iteration++) {
+    //! Raise all events at once, as during a throughput test
+    scheduler_cb->event_map |= event_map;
+    rsi_scheduler(scheduler_cb);
+  }
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_end);
+
+  memcpy(rsi_driver_cb->event_list, saved_events, sizeof(saved_events));
+  scheduler_cb->event_map &= ~event_map;
+
+  cpu_ns = benchmark_elapsed_ns(&cpu_start, &cpu_end);
+
+  LOG_PRINT("\r\nScheduler runs  : %u x %u events\r\n", BENCHMARK_DISPATCH_ITERATIONS, 3);
+  LOG_PRINT("Dispatched      : %lu\r\n", (unsigned long)benchmark_dispatched);
+  LOG_PRINT("CPU time        : %llu us\r\n", (unsigned long long)(cpu_ns / 1000));
+  LOG_PRINT("CPU per event   : %.2f ns\r\n", benchmark_dispatched ? (double)cpu_ns / benchmark_dispatched : 0.0);
+
+  //! Every event raised must be dispatched exactly once
+  return (benchmark_dispatched == 3U * BENCHMARK_DISPATCH_ITERATIONS) ? RSI_SUCCESS : RSI_FAILURE;
+}
+#endif
+
+#if BENCHMARK_SELECT
+//! Wait until socket is ready to read or write
+static int32_t benchmark_select(int32_t client_socket, uint8_t write)
+{
+  rsi_fd_set fds;
+  int32_t status;
+
+  RSI_FD_ZERO(&fds);
+  RSI_FD_SET(client_socket, &fds);
+  if (write) {
+    status = rsi_select(client_socket + 1, NULL, &fds, NULL, NULL, NULL);
+  } else {
+    status = rsi_select(client_socket + 1, &fds, NULL, NULL, NULL, NULL);
+  }
+  if ((status <= 0) || !RSI_FD_ISSET(client_socket, &fds)) {
+    LOG_PRINT("\r\nSelect Failed, Status : %ld\r\n", (long)status);
+    return RSI_FAILURE;
+  }
+  return RSI_SUCCESS;
+}
+#endif
+
+#if BENCHMARK_EPOLL
+//! Epoll instance the socket is registered on
+static int32_t benchmark_epfd = -1;
+
+//! Wait until socket is ready to read or write
+static int32_t benchmark_epoll(int32_t client_socket, uint8_t write)
+{
+  struct rsi_epoll_event event;
+  int32_t status;
+
+  event.events  = write ? RSI_EPOLLOUT : RSI_EPOLLIN;
+  event.data.fd = client_socket;
+  status        = rsi_epoll_ctl(benchmark_epfd, RSI_EPOLL_CTL_MOD, client_socket, &event);
+  if (status == RSI_SUCCESS) {
+    status = rsi_epoll_wait(benchmark_epfd, &event, 1, -1);
+  }
+  if ((status != 1) || (event.data.fd != client_socket) || !(event.events & (write ? RSI_EPOLLOUT : RSI_EPOLLIN))) {
+    LOG_PRINT("\r\nEpoll Failed, Status : %ld\r\n", (long)status);
+    return RSI_FAILURE;
+  }
+  return RSI_SUCCESS;
+}
+#endif
+
+//! Send and receive back data over socket, measuring host cost
+static int32_t benchmark_echo(int32_t client_socket)
+{
+  struct timespec wall_start, wall_end, cpu_start, cpu_end;
+  uint64_t wall_ns, cpu_ns, total_bytes;
+  rsi_sim_stats_t stats;
+  int32_t status;
+  int32_t sent;
+  int32_t received;
+  uint32_t iteration;
+  uint32_t i;
+
+  for (i = 0; i < BENCHMARK_BUFFER_LEN; i++) {
+    send_buffer[i] = (uint8_t)i;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &wall_start);
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+
+  for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+    sent = 0;
+    while (sent < BENCHMARK_BUFFER_LEN) {
+#if BENCHMARK_SELECT
+      if (benchmark_select(client_socket, 1) != RSI_SUCCESS) {
+        return RSI_FAILURE;
+      }
+#endif
+#if BENCHMARK_EPOLL
+      if (benchmark_epoll(client_socket, 1) != RSI_SUCCESS) {
+        return RSI_FAILURE;
+      }
+#endif
+#if BENCHMARK_MSG
+      status =
+        benchmark_msg(client_socket, &send_buffer[sent], RSI_MIN(BENCHMARK_SEND_LEN, BENCHMARK_BUFFER_LEN - sent), 1);
+#else
+      status = rsi_send(client_socket,
+                        (int8_t *)&send_buffer[sent],
+                        RSI_MIN(BENCHMARK_SEND_LEN, BENCHMARK_BUFFER_LEN - sent),
+                        0);
+#endif
+      if (status < 0) {
+        LOG_PRINT("\r\nSend Failed, Error Code : 0x%lX\r\n", (long)rsi_wlan_get_status());
+        return status;
+      }
+      sent += status;
+    }
+
+    received = 0;
+    while (received < BENCHMARK_BUFFER_LEN) {
+#if BENCHMARK_SELECT
+      if (benchmark_select(client_socket, 0) != RSI_SUCCESS) {
+        return RSI_FAILURE;
+      }
+#endif
+#if BENCHMARK_EPOLL
+      if (benchmark_epoll(client_socket, 0) != RSI_SUCCESS) {
+        return RSI_FAILURE;
+      }
+#endif
+#if BENCHMARK_MSG
+      status = benchmark_msg(client_socket,
+                             &recv_buffer[received],
+                             RSI_MIN(BENCHMARK_RECV_LEN, BENCHMARK_BUFFER_LEN - received),
+                             0);
+#else
+      status =
+        rsi_recv(client_socket, &recv_buffer[received], RSI_MIN(BENCHMARK_RECV_LEN, BENCHMARK_BUFFER_LEN - received), 0);
+#endif
+      if (status <= 0) {
+        LOG_PRINT("\r\nReceive Failed, Error Code : 0x%lX\r\n", (long)rsi_wlan_get_status());
+        return RSI_FAILURE;
+      }
+      received += status;
+    }
+
+    if (memcmp(send_buffer, recv_buffer, BENCHMARK_BUFFER_LEN)) {
+      LOG_PRINT("\r\nEchoed data mismatch in iteration %lu\r\n", (unsigned long)iteration);
+      return RSI_FAILURE;
+    }
+  }
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_end);
+  clock_gettime(CLOCK_MONOTONIC, &wall_end);
+
+  wall_ns     = benchmark_elapsed_ns(&wall_start, &wall_end);
+  cpu_ns      = benchmark_elapsed_ns(&cpu_start, &cpu_end);
+  total_bytes = 2ULL * BENCHMARK_BUFFER_LEN * BENCHMARK_ITERATIONS;
+  rsi_sim_get_stats(&stats);
+
+  LOG_PRINT("\r\nIterations      : %u x %u bytes\r\n", BENCHMARK_ITERATIONS, BENCHMARK_BUFFER_LEN);
+  LOG_PRINT("Wall time       : %llu us\r\n", (unsigned long long)(wall_ns / 1000));
+  LOG_PRINT("CPU time        : %llu us\r\n", (unsigned long long)(cpu_ns / 1000));
+  LOG_PRINT("CPU per byte    : %.2f ns\r\n", (double)cpu_ns / total_bytes);
+  LOG_PRINT("CPU per frame   : %.2f ns\r\n", (double)cpu_ns / (stats.tx_frames + stats.rx_frames));
+  LOG_PRINT("Frames TX/RX    : %lu/%lu\r\n", (unsigned long)stats.tx_frames, (unsigned long)stats.rx_frames);
+  LOG_PRINT("Bytes TX/RX     : %lu/%lu\r\n", (unsigned long)stats.tx_bytes, (unsigned long)stats.rx_bytes);
+  LOG_PRINT("Interrupts      : %lu\r\n", (unsigned long)stats.interrupts);
+  LOG_PRINT("Dropped         : %lu\r\n", (unsigned long)stats.rx_dropped);
+
+  return RSI_SUCCESS;
+}
+
+#if BENCHMARK_UDP_BATCH
+//! Send small UDP datagrams in batches, measuring host cost. Echoed datagrams are not read.
+static int32_t benchmark_udp(void)
+{
+  struct rsi_mmsghdr msgvec[BENCHMARK_UDP_BATCH];
+  struct rsi_iovec iov;
+  struct rsi_sockaddr_in server_addr;
+  struct timespec wall_start, wall_end, cpu_start, cpu_end;
+  uint64_t wall_ns, cpu_ns;
+  int32_t udp_socket;
+  int32_t status;
+  uint32_t iteration;
+  uint32_t i;
+
+  udp_socket = rsi_socket(AF_INET, SOCK_DGRAM, 0);
+  if (udp_socket < 0) {
+    LOG_PRINT("\r\nUDP Socket Create Failed, Error Code : 0x%lX\r\n", (long)rsi_wlan_get_status());
+    return RSI_FAILURE;
+  }
+
+  memset(&server_addr, 0, sizeof(server_addr));
+  server_addr.sin_family      = AF_INET;
+  server_addr.sin_port        = htons(SERVER_PORT);
+  server_addr.sin_addr.s_addr = SERVER_IP_ADDRESS;
+
+  //! All datagrams carry the same data to the same peer
+  iov.iov_base = send_buffer;
+  iov.iov_len  = RSI_MIN(BENCHMARK_UDP_LEN, BENCHMARK_BUFFER_LEN);
+  memset(msgvec, 0, sizeof(msgvec));
+  for (i = 0; i < BENCHMARK_UDP_BATCH; i++) {
+    msgvec[i].msg_hdr.msg_name    = &server_addr;
+    msgvec[i].msg_hdr.msg_namelen = sizeof(server_addr);
+    msgvec[i].msg_hdr.msg_iov     = &iov;
+    msgvec[i].msg_hdr.msg_iovlen  = 1;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &wall_start);
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+
+  for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+    status = rsi_sendmmsg(udp_socket, msgvec, BENCHMARK_UDP_BATCH, 0);
+    if (status != BENCHMARK_UDP_BATCH) {
+      LOG_PRINT("\r\nUDP Send Failed, %ld datagrams sent, Error Code : 0x%lX\r\n",
+                (long)status,
+                (long)rsi_wlan_get_status());
+      rsi_shutdown(udp_socket, 0);
+      return RSI_FAILURE;
+    }
+  }
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_end);
+  clock_gettime(CLOCK_MONOTONIC, &wall_end);
+
+  wall_ns = benchmark_elapsed_ns(&wall_start, &wall_end);
+  cpu_ns  = benchmark_elapsed_ns(&cpu_start, &cpu_end);
+
+  LOG_PRINT("\r\nUDP datagrams   : %u x %u x %u bytes\r\n",
+            BENCHMARK_ITERATIONS,
+            BENCHMARK_UDP_BATCH,
+            (unsigned)iov.iov_len);
+  LOG_PRINT("Wall time       : %llu us\r\n", (unsigned long long)(wall_ns / 1000));
+  LOG_PRINT("CPU time        : %llu us\r\n", (unsigned long long)(cpu_ns / 1000));
+  LOG_PRINT("CPU per datagram: %.2f ns\r\n", (double)cpu_ns / ((uint64_t)BENCHMARK_ITERATIONS * BENCHMARK_UDP_BATCH));
+
+  rsi_shutdown(udp_socket, 0);
+  return RSI_SUCCESS;
+}
+#endif
+
+//! Host stack benchmark application
+int32_t rsi_host_stack_benchmark_app()
+{
+  int32_t client_socket;
+  struct rsi_sockaddr_in server_addr;
+  int32_t status    = RSI_SUCCESS;
+  uint8_t dhcp_mode = (RSI_DHCP | RSI_DHCP_UNICAST_OFFER);
+
+#if BENCHMARK_DISPATCH
+  //! Measure dispatch while no module traffic is pending
+  status = benchmark_dispatch();
+  if (status != RSI_SUCCESS) {
+    LOG_PRINT("\r\nEvent Dispatch Benchmark Failed\r\n");
+    return status;
+  }
+#endif
+
+  //! WC initialization
+  status = rsi_wireless_init(0, 0);
+  if (status != RSI_SUCCESS) {
+    LOG_PRINT("\r\nWireless Initialization Failed, Error Code : 0x%lX\r\n", (long)status);
+    return status;
+  } else {
+    LOG_PRINT("\r\nWireless Initialization Success\r\n");
+  }
+
+  //! Connect to an Access point
+  status = rsi_wlan_connect((int8_t *)SSID, SECURITY_TYPE, PSK);
+  if (status != RSI_SUCCESS) {
+    LOG_PRINT("\r\nWLAN AP Connect Failed, Error Code : 0x%lX\r\n", (long)status);
+    return status;
+  } else {
+    LOG_PRINT("\r\nWLAN AP Connect Success\r\n");
+  }
+
+  //! Configure IP
+  status = rsi_config_ipaddress(RSI_IP_VERSION_4, dhcp_mode, 0, 0, 0, NULL, 0, 0);
+  if (status != RSI_SUCCESS) {
+    LOG_PRINT("\r\nIP Config Failed, Error Code : 0x%lX\r\n", (long)status);
+    return status;
+  } else {
+    LOG_PRINT("\r\nIP Config Success\r\n");
+  }
+
+  //! Create socket
+  client_socket = rsi_socket(AF_INET, SOCK_STREAM, 0);
+  if (client_socket < 0) {
+    status = rsi_wlan_get_status();
+    LOG_PRINT("\r\nSocket Create Failed, Error Code : 0x%lX\r\n", (long)status);
+    return status;
+  } else {
+    LOG_PRINT("\r\nSocket Create Success\r\n");
+  }
+
+  //! Set server structure
+  memset(&server_addr, 0, sizeof(server_addr));
+  server_addr.sin_family      = AF_INET;
+  server_addr.sin_port        = htons(SERVER_PORT);
+  server_addr.sin_addr.s_addr = SERVER_IP_ADDRESS;
+
+  //! Connect to server socket
+  status = rsi_connect(client_socket, (struct rsi_sockaddr *)&server_addr, sizeof(server_addr));
+  if (status != RSI_SUCCESS) {
+    status = rsi_wlan_get_status();
+    rsi_shutdown(client_socket, 0);
+    LOG_PRINT("\r\nConnect to Server Socket Failed, Error Code : 0x%lX\r\n", (long)status);
+    return status;
+  } else {
+    LOG_PRINT("\r\nConnect to Server Socket Success\r\n");
+  }
+
+#if BENCHMARK_EPOLL
+  {
+    struct rsi_epoll_event event;
+
+    //! Register socket once, events are changed before each wait
+    benchmark_epfd = rsi_epoll_create();
+    event.events   = RSI_EPOLLIN;
+    event.data.fd  = client_socket;
+    if ((benchmark_epfd < 0) || (rsi_epoll_ctl(benchmark_epfd, RSI_EPOLL_CTL_ADD, client_socket, &event) < 0)) {
+      LOG_PRINT("\r\nEpoll Create Failed\r\n");
+      rsi_shutdown(client_socket, 0);
+      return RSI_FAILURE;
+    }
+  }
+#endif
+
+  status = benchmark_echo(client_socket);
+#if BENCHMARK_UDP_BATCH
+  if (status == RSI_SUCCESS) {
+    status = benchmark_udp();
+  }
+#endif
+
+  rsi_shutdown(client_socket, 0);
+#if BENCHMARK_EPOLL
+  rsi_epoll_close(benchmark_epfd);
+#endif
+
+  return status;
+}
+
+#ifdef RSI_WITH_OS
+//! Runs application and ends process once it is done
+void rsi_host_stack_benchmark_task(void *arg)
+{
+  UNUSED_PARAMETER(arg);
+  exit(rsi_host_stack_benchmark_app() == RSI_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+#endif
+
+int main()
+{
+  int32_t status;
+
+#ifdef RSI_WITH_OS
+
+  rsi_task_handle_t wlan_task_handle = NULL;
+
+  rsi_task_handle_t driver_task_handle = NULL;
+#endif
+
+  //! Driver initialization
+  status = rsi_driver_init(global_buf, GLOBAL_BUFF_LEN);
+  if ((status < 0) || (status > GLOBAL_BUFF_LEN)) {
+    return status;
+  }
+
+  //! Redpine module intialisation
+  status = rsi_device_init(LOAD_NWP_FW);
+  if (status != RSI_SUCCESS) {
+    LOG_PRINT("\r\nDevice Initialization Failed, Error Code : 0x%lX\r\n", (long)status);
+    return status;
+  } else {
+    LOG_PRINT("\r\nDevice Initialization Success\r\n");
+  }
+
+#ifdef RSI_WITH_OS
+  //! OS case
+  //! Task created for WLAN task
+  rsi_task_create((rsi_task_function_t)rsi_host_stack_benchmark_task,
+                  (uint8_t *)"wlan_task",
+                  RSI_WLAN_TASK_STACK_SIZE,
+                  NULL,
+                  RSI_WLAN_TASK_PRIORITY,
+                  &wlan_task_handle);
+
+  //! Task created for Driver task
+  rsi_task_create((rsi_task_function_t)rsi_wireless_driver_task,
+                  (uint8_t *)"driver_task",
+                  RSI_DRIVER_TASK_STACK_SIZE,
+                  NULL,
+                  RSI_DRIVER_TASK_PRIORITY,
+                  &driver_task_handle);
+
+  //! OS TAsk Start the scheduler
+  rsi_start_os_scheduler();
+
+#else
+  //! NON - OS case
+  //! Call benchmark application
+  status = rsi_host_stack_benchmark_app();
+#endif
+
+  return (status == RSI_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -157,7 +157,7 @@ rsi_wlan_app_cb_t rsi_wlan_app_cb;
 extern int rsi_getsockopt(int32_t sockID,
                           int level,
                           int option_name,
-                          const void *option_value,
+                          void *option_value,
                           rsi_socklen_t option_len);
 
 uint32_t socket_select_response = 0;
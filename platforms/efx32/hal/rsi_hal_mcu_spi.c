@@ -31,6 +31,8 @@ LDMA_TransferCfg_t ldmaTXConfig;
 LDMA_Descriptor_t ldmaRXDescriptor;
 LDMA_TransferCfg_t ldmaRXConfig;
 volatile uint8_t rx_done;
+// Completion handler of asynchronous transfer in progress
+static void (*volatile spi_transfer_done)(void);
 
 
 /*==================================================================*/
@@ -61,18 +63,19 @@ void cs_disable(void)
 
 /*==================================================================*/
 /**
- * @fn         int16_t rsi_spi_transfer(uint8_t *ptrBuf,uint16_t bufLen,uint8_t *valBuf,uint8_t mode)
+ * @fn         static void rsi_spi_ldma_start(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode)
  * @param[in]  uint8_t *tx_buff, pointer to the buffer with the data to be transfered
  * @param[in]  uint8_t *rx_buff, pointer to the buffer to store the data received
  * @param[in]  uint16_t transfer_length, Number of bytes to send and receive
  * @param[in]  uint8_t mode, To indicate mode 8 BIT/32 BIT mode transfers.
  * @param[out] None
- * @return     0, 0=success
+ * @return     None
  * @section description
- * This API is used to transfer/receive data to the Wi-Fi module through the SPI interface.
+ * This API is used to start the LDMA channels of a transfer through the SPI interface.
  */
-int16_t rsi_spi_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode)
+static void rsi_spi_ldma_start(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode)
 {
+  UNUSED_PARAMETER(mode);
 
   if (tx_buff == NULL) {
     tx_buff = (uint8_t*)&dummy;
@@ -98,6 +101,23 @@ int16_t rsi_spi_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_l
   // Start both channels
   LDMA_StartTransfer(RX_LDMA_CHANNEL, &ldmaRXConfig, &ldmaRXDescriptor);
   LDMA_StartTransfer(TX_LDMA_CHANNEL, &ldmaTXConfig, &ldmaTXDescriptor);
+}
+
+/*==================================================================*/
+/**
+ * @fn         int16_t rsi_spi_transfer(uint8_t *ptrBuf,uint16_t bufLen,uint8_t *valBuf,uint8_t mode)
+ * @param[in]  uint8_t *tx_buff, pointer to the buffer with the data to be transfered
+ * @param[in]  uint8_t *rx_buff, pointer to the buffer to store the data received
+ * @param[in]  uint16_t transfer_length, Number of bytes to send and receive
+ * @param[in]  uint8_t mode, To indicate mode 8 BIT/32 BIT mode transfers.
+ * @param[out] None
+ * @return     0, 0=success
+ * @section description
+ * This API is used to transfer/receive data to the Wi-Fi module through the SPI interface.
+ */
+int16_t rsi_spi_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode)
+{
+  rsi_spi_ldma_start(tx_buff, rx_buff, transfer_length, mode);
 
   // Wait in EM1 until all data is received
   while (!rx_done);
@@ -105,6 +125,52 @@ int16_t rsi_spi_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_l
   return 0;
 }
 
+/*==================================================================*/
+/**
+ * @fn         int16_t rsi_spi_transfer_async(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode, void (*transfer_done)(void))
+ * @param[in]  uint8_t *tx_buff, pointer to the buffer with the data to be transfered
+ * @param[in]  uint8_t *rx_buff, pointer to the buffer to store the data received
+ * @param[in]  uint16_t transfer_length, Number of bytes to send and receive
+ * @param[in]  uint8_t mode, To indicate mode 8 BIT/32 BIT mode transfers.
+ * @param[in]  transfer_done, called from interrupt context once all data is received
+ * @param[out] None
+ * @return     0, 0=success, transfer is started
+ * @section description
+ * This API is used to start a transfer to/from the Wi-Fi module through the SPI interface
+ * and return without waiting for it.
+ */
+int16_t rsi_spi_transfer_async(uint8_t *tx_buff,
+                               uint8_t *rx_buff,
+                               uint16_t transfer_length,
+                               uint8_t mode,
+                               void (*transfer_done)(void))
+{
+  spi_transfer_done = transfer_done;
+  rsi_spi_ldma_start(tx_buff, rx_buff, transfer_length, mode);
+
+  return 0;
+}
+
+/*==================================================================*/
+/**
+ * @fn         void rsi_spi_transfer_abort(void)
+ * @param[out] None
+ * @return     None
+ * @section description
+ * This API is used to abort an asynchronous transfer started by rsi_spi_transfer_async() that did not
+ * complete in time. Completion handler is not called once this returns.
+ */
+void rsi_spi_transfer_abort(void)
+{
+  // Stop both channels first, completion can not be reported after this
+  LDMA_StopTransfer(TX_LDMA_CHANNEL);
+  LDMA_StopTransfer(RX_LDMA_CHANNEL);
+  spi_transfer_done = NULL;
+
+  // Drop data of the aborted transfer left in USART
+  USART2->CMD = USART_CMD_CLEARTX | USART_CMD_CLEARRX;
+}
+
 /**************************************************************************//**
  * @brief LDMA IRQHandler
  *****************************************************************************/
@@ -123,6 +189,12 @@ void LDMA_IRQHandler()
   if (flags & (1 << RX_LDMA_CHANNEL)) {
     LDMA_IntClear(1 << RX_LDMA_CHANNEL);
     rx_done = true;
+    // Wake up the task waiting for asynchronous transfer
+    if (spi_transfer_done != NULL) {
+      void (*transfer_done)(void) = spi_transfer_done;
+      spi_transfer_done           = NULL;
+      transfer_done();
+    }
   }
 
   // Stop in case there was an error
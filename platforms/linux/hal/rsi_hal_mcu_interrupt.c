@@ -0,0 +1,131 @@
+/*******************************************************************************
+* @file  rsi_hal_mcu_interrupt.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_hal_mcu_interrupt.c
+ *
+ * @brief HAL INTERRUPT: Functions related to HAL Interrupts
+ *
+ * @section Description
+ * This file contains the interrupt functions of the Linux host. The module
+ * interrupt line is level triggered and high while the simulated module holds
+ * frames for the host. Raising it calls the registered handler right away
+ * from the thread that made the module raise it, unless it is masked, in
+ * which case the handler runs once it is unmasked.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+#include "rsi_sim.h"
+
+static void (*rsi_hal_intr_handler)(void);
+
+static volatile uint8_t rsi_hal_intr_masked = 1;
+
+/*===================================================*/
+/**
+ * @fn           void rsi_sim_intr_assert(void)
+ * @brief        Raise the module interrupt
+ * @param[in]    none
+ * @param[out]   none
+ * @return       none
+ * @description  Called by simulated module whenever it queues a frame for host.
+ */
+void rsi_sim_intr_assert(void)
+{
+  if (!rsi_hal_intr_masked && (rsi_hal_intr_handler != NULL)) {
+    rsi_hal_intr_handler();
+  }
+}
+
+/*===================================================*/
+/**
+ * @fn           void rsi_hal_intr_config(void (* rsi_interrupt_handler)())
+ * @brief        Starts and enables the SPI interrupt
+ * @param[in]    rsi_interrupt_handler() ,call back function to handle interrupt
+ * @param[out]   none
+ * @return       none
+ * @description  This HAL API should contain the code to initialize the register/pins
+ *               related to interrupts and enable the interrupts.
+ */
+void rsi_hal_intr_config(void (*rsi_interrupt_handler)(void))
+{
+  rsi_hal_intr_handler = rsi_interrupt_handler;
+}
+
+/*===================================================*/
+/**
+ * @fn           void rsi_hal_intr_mask(void)
+ * @brief        Disables the SPI Interrupt
+ * @param[in]    none
+ * @param[out]   none
+ * @return       none
+ * @description  This HAL API should contain the code to mask/disable interrupts.
+ */
+void rsi_hal_intr_mask(void)
+{
+  rsi_hal_intr_masked = 1;
+}
+
+/*===================================================*/
+/**
+ * @fn           void rsi_hal_intr_unmask(void)
+ * @brief        Enables the SPI interrupt
+ * @param[in]    none
+ * @param[out]   none
+ * @return       none
+ * @description  This HAL API should contain the code to enable interrupts.
+ *               Interrupt is level triggered, so pending frames raise it right away.
+ */
+void rsi_hal_intr_unmask(void)
+{
+  rsi_hal_intr_masked = 0;
+  if (rsi_sim_rx_pending()) {
+    rsi_sim_intr_assert();
+  }
+}
+
+/*===================================================*/
+/**
+ * @fn           void rsi_hal_intr_clear(void)
+ * @brief        Clears the pending interrupt
+ * @param[in]    none
+ * @param[out]   none
+ * @return       none
+ * @description  This HAL API should contain the code to clear the handled interrupts.
+ *               Nothing is latched for a level triggered interrupt.
+ */
+void rsi_hal_intr_clear(void)
+{
+  return;
+}
+
+/*===================================================*/
+/**
+ * @fn          uint8_t rsi_hal_intr_pin_status(void)
+ * @brief       Checks the SPI interrupt at pin level
+ * @param[in]   none
+ * @param[out]  uint8_t, interrupt status
+ * @return      none
+ * @description This API is used to check interrupt pin status(pin level whether it is high/low).
+ */
+uint8_t rsi_hal_intr_pin_status(void)
+{
+  return rsi_hal_get_gpio(RSI_HAL_MODULE_INTERRUPT_PIN);
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* @file  rsi_hal_mcu_ioports.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_hal_mcu_ioports.c
+ *
+ * @brief Functions to control IO pins of the Linux host
+ *
+ * @section Description
+ * This file contains API to control the pins which interface with the
+ * simulated module. Only the module interrupt pin carries a level, output
+ * pins are accepted and ignored.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+#include "rsi_sim.h"
+
+/*===========================================================*/
+/**
+ * @fn            void rsi_hal_config_gpio(uint8_t gpio_number,uint8_t mode,uint8_t value)
+ * @brief         Configures gpio pin in output mode,with a value
+ * @param[in]     uint8_t gpio_number, gpio pin number to be configured
+ * @param[in]     uint8_t mode , input/output mode of the gpio pin to configure
+ *                0 - input mode
+ *                1 - output mode
+ * @param[in]     uint8_t value, default value to be driven if gpio is configured in output mode
+ *                0 - low
+ *                1 - high
+ * @param[out]    none
+ * @return        none
+ * @description This API is used to configure host gpio pin in output mode.
+ */
+void rsi_hal_config_gpio(uint8_t gpio_number, uint8_t mode, uint8_t value)
+{
+  UNUSED_PARAMETER(gpio_number); //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(mode);        //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(value);       //This statement is added only to resolve compilation warning, value is unchanged
+}
+
+/*===========================================================*/
+/**
+ * @fn            void rsi_hal_set_gpio(uint8_t gpio_number)
+ * @brief         Makes/drives the gpio  value high
+ * @param[in]     uint8_t gpio_number, gpio pin number
+ * @param[out]    none
+ * @return        none
+ * @description   This API is used to drives or makes the host gpio value high.
+ */
+void rsi_hal_set_gpio(uint8_t gpio_number)
+{
+  UNUSED_PARAMETER(gpio_number); //This statement is added only to resolve compilation warning, value is unchanged
+}
+
+/*===========================================================*/
+/**
+ * @fn          uint8_t rsi_hal_get_gpio(uint8_t gpio_number)
+ * @brief       get the gpio pin value
+ * @param[in]   uint8_t gpio_number, gpio pin number
+ * @param[out]  none
+ * @return      gpio pin value
+ * @description This API is used to configure get the gpio pin value.
+ */
+uint8_t rsi_hal_get_gpio(uint8_t gpio_number)
+{
+  if (gpio_number == RSI_HAL_MODULE_INTERRUPT_PIN) {
+    // Interrupt is high while module holds frames for host
+    return (rsi_sim_rx_pending() != 0);
+  }
+  return 0;
+}
+
+/*===========================================================*/
+/**
+ * @fn            void rsi_hal_clear_gpio(uint8_t gpio_number)
+ * @brief         Makes/drives the gpio value to low
+ * @param[in]     uint8_t gpio_number, gpio pin number
+ * @param[out]    none
+ * @return        none
+ * @description   This API is used to drives or makes the host gpio value low.
+ */
+void rsi_hal_clear_gpio(uint8_t gpio_number)
+{
+  UNUSED_PARAMETER(gpio_number); //This statement is added only to resolve compilation warning, value is unchanged
+}
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* @file  rsi_hal_mcu_platform_init.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_hal_mcu_platform_init.c
+ *
+ * @brief HAL Board Init: Functions related to platform initialization
+ *
+ * @section Description
+ * This file contains the board initialization of the Linux host. There is no
+ * hardware to bring up, the simulated module starts in its bootloader when the
+ * device interface is initialized.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+
+/*==============================================*/
+/**
+ * @fn           void rsi_hal_board_init()
+ * @brief        This function Initializes the platform
+ * @param[in]    none
+ * @param[out]   none
+ * @return       none
+ * @section description
+ * This function initializes the platform
+ *
+ */
+void rsi_hal_board_init(void)
+{
+  return;
+}
+
+/*==============================================*/
+/**
+ * @fn           void rsi_switch_to_high_clk_freq()
+ * @brief        This function intializes SPI to high clock
+ * @param[in]    none
+ * @param[out]   none
+ * @return       none
+ * @section description
+ * This function intializes SPI to high clock
+ *
+ */
+void rsi_switch_to_high_clk_freq(void)
+{
+  return;
+}
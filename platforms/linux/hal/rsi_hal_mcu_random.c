@@ -0,0 +1,47 @@
+/*******************************************************************************
+* @file  rsi_hal_mcu_random.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_hal_mcu_random.c
+ *
+ * @brief HAL RANDOM: Functions related to random number generation
+ *
+ * @section Description
+ * This file contains the random number generator of the Linux host.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+#include <stdlib.h>
+
+/*==============================================*/
+/**
+ * @fn           uint32_t rsi_get_random_number(void)
+ * @brief        This function generate random number
+ * @param[in]    none
+ * @param[out]   none
+ * @return       random number
+ * @section description
+ * This function generates random number
+ *
+ */
+uint32_t rsi_get_random_number(void)
+{
+  return (uint32_t)rand();
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* @file  rsi_hal_mcu_timer.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_hal_mcu_timer.c
+ *
+ * @brief HAL TIMER: Functions related to HAL timers
+ *
+ * @section Description
+ * This file contains the timer functions of the Linux host, backed by the
+ * monotonic clock.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+#include <time.h>
+#include <errno.h>
+
+/*===================================================*/
+/**
+ * @fn           static void rsi_hal_sleep(struct timespec *delay)
+ * @brief        Sleep for a delay, resuming after signals
+ * @param[in]    delay, time to sleep
+ * @return       none
+ */
+static void rsi_hal_sleep(struct timespec *delay)
+{
+  while (nanosleep(delay, delay) && (errno == EINTR))
+    ;
+}
+
+/*===================================================*/
+/**
+ * @fn           int32_t rsi_timer_start(uint8_t timer_no, uint8_t mode,uint8_t type,uint32_t duration,void (* rsi_timer_expiry_handler)())
+ * @brief        Starts and configures timer
+ * @param[in]    timer_node, timer node to be configured.
+ * @param[in]    mode , mode of the timer
+ *               0 - Micro seconds mode
+ *               1 - Milli seconds mode
+ * @param[in]    type, type of  the timer
+ *               0 - single shot type
+ *               1 - periodic type
+ * @param[in]    duration, timer duration
+ * @param[in]    rsi_timer_expiry_handler() ,call back function to handle timer interrupt
+ * @param[out]   none
+ * @return       0 - success
+ *               !0 - Failure
+ * @description  This HAL API should contain the code to initialize the timer and start the timer
+ *
+ */
+int32_t rsi_timer_start(uint8_t timer_node,
+                        uint8_t mode,
+                        uint8_t type,
+                        uint32_t duration,
+                        void (*rsi_timer_expiry_handler)(void))
+{
+  UNUSED_PARAMETER(timer_node);               //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(mode);                     //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(type);                     //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(duration);                 //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(rsi_timer_expiry_handler); //This statement is added only to resolve compilation warning, value is unchanged
+
+  return 0;
+}
+
+/*===================================================*/
+/**
+ * @fn           int32_t rsi_timer_stop(uint8_t timer_no)
+ * @brief        Stops timer
+ * @param[in]    timer_node, timer node to stop
+ * @param[out]   none
+ * @return       0 - success
+ *               !0 - Failure
+ * @description  This HAL API should contain the code to stop the timer
+ *
+ */
+int32_t rsi_timer_stop(uint8_t timer_node)
+{
+  UNUSED_PARAMETER(timer_node); //This statement is added only to resolve compilation warning, value is unchanged
+
+  return 0;
+}
+
+/*===================================================*/
+/**
+ * @fn           uint32_t rsi_timer_read(uint8_t timer_node)
+ * @brief        read timer
+ * @param[in]    timer_node, timer node to read
+ * @param[out]   none
+ * @return       timer value
+ * @description  This HAL API should contain API to  read the timer
+ *
+ */
+uint32_t rsi_timer_read(uint8_t timer_node)
+{
+  UNUSED_PARAMETER(timer_node); //This statement is added only to resolve compilation warning, value is unchanged
+
+  return 0;
+}
+
+/*===================================================*/
+/**
+ * @fn           void rsi_delay_us(uint32_t delay)
+ * @brief        create delay in micro seconds
+ * @param[in]    delay_us, timer delay in micro seconds
+ * @param[out]   none
+ * @return       none
+ * @description  This HAL API should contain the code to create delay in micro seconds
+ *
+ */
+void rsi_delay_us(uint32_t delay_us)
+{
+  struct timespec delay;
+
+  delay.tv_sec  = delay_us / 1000000;
+  delay.tv_nsec = (delay_us % 1000000) * 1000L;
+  rsi_hal_sleep(&delay);
+}
+
+/*===================================================*/
+/**
+ * @fn           void rsi_delay_ms(uint32_t delay)
+ * @brief        create delay in milli seconds
+ * @param[in]    delay, timer delay in milli seconds
+ * @param[out]   none
+ * @return       none
+ * @description  This HAL API should contain the code to create delay in milli seconds
+ *
+ */
+void rsi_delay_ms(uint32_t delay_ms)
+{
+#ifdef RSI_WITH_OS
+  rsi_os_task_delay(delay_ms);
+#else
+  struct timespec delay;
+
+  delay.tv_sec  = delay_ms / 1000;
+  delay.tv_nsec = (delay_ms % 1000) * 1000000L;
+  rsi_hal_sleep(&delay);
+#endif
+}
+
+/*===================================================*/
+/**
+ * @fn           uint32_t rsi_hal_gettickcount()
+ * @brief        provides a tick value in milliseconds
+ * @return       tick value
+ * @description  This HAL API should contain the code to read the timer tick count value in milliseconds
+ *
+ */
+uint32_t rsi_hal_gettickcount(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((now.tv_sec * 1000) + (now.tv_nsec / 1000000));
+}
+
+#ifdef RSI_WITH_OS
+/*===================================================*/
+/**
+ * @fn           void rsi_os_delay_ms(uint32_t delay_ms)
+ * @brief        create delay in milli seconds from task context
+ * @param[in]    delay_ms, delay in milli seconds
+ * @return       none
+ *
+ */
+void rsi_os_delay_ms(uint32_t delay_ms)
+{
+  rsi_os_task_delay(delay_ms);
+}
+#endif
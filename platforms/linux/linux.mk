@@ -0,0 +1,31 @@
+# Host build against the simulated module, no hardware required.
+# Frames exchanged with the module are served by an in-process firmware model,
+# see platforms/linux/sim. Define RSI_WITH_OS in the application Makefile to
+# run the driver task on a pthread, otherwise the application runs bare metal.
+
+PROG_EXTENSION :=
+
+rm=rm -f
+CC=gcc
+AR=ar
+
+SDK_FEATURES += linux
+
+# Simulated module takes the place of the SPI device interface
+DEVICE_INTERFACE_SOURCES = $(RSI_SDK_PATH)/platforms/linux/sim/rsi_sim_device.c \
+                           $(RSI_SDK_PATH)/platforms/linux/sim/rsi_sim_fw_model.c
+
+linux_SOURCES += $(RSI_SDK_PATH)/platforms/linux/hal/rsi_hal_mcu_interrupt.c \
+                 $(RSI_SDK_PATH)/platforms/linux/hal/rsi_hal_mcu_ioports.c \
+                 $(RSI_SDK_PATH)/platforms/linux/hal/rsi_hal_mcu_timer.c \
+                 $(RSI_SDK_PATH)/platforms/linux/hal/rsi_hal_mcu_platform_init.c \
+                 $(RSI_SDK_PATH)/platforms/linux/hal/rsi_hal_mcu_random.c \
+                 $(RSI_SDK_PATH)/sapi/rtos/pthread_wrapper/rsi_os_wrapper.c
+
+linux_CFLAGS += -I $(RSI_SDK_PATH)/platforms/linux/sim \
+                -D RSI_SPI_INTERFACE \
+                -D _GNU_SOURCE
+
+LIBS += -lpthread
+
+linux: all
@@ -0,0 +1,7 @@
+#ifndef RSI_BOARD_CONFIG_H
+#define RSI_BOARD_CONFIG_H
+
+// Linux host talking to the simulated module, see platforms/linux/sim
+// Bus interface is selected in platforms/linux/linux.mk
+
+#endif
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* @file  rsi_sim.h
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+
+#ifndef RSI_SIM_H
+#define RSI_SIM_H
+
+#include "rsi_data_types.h"
+
+/******************************************************
+ * *                      Macros
+ * ******************************************************/
+// Number of frames the simulated module can hold for the host
+#ifndef RSI_SIM_RX_QUEUE_DEPTH
+#define RSI_SIM_RX_QUEUE_DEPTH 16
+#endif
+
+// Bytes of echo data the simulated module buffers per socket
+#ifndef RSI_SIM_SOCKET_BUFFER_LEN
+#define RSI_SIM_SOCKET_BUFFER_LEN 8192
+#endif
+
+// Number of sockets the simulated module supports
+#ifndef RSI_SIM_MAX_SOCKETS
+#define RSI_SIM_MAX_SOCKETS 10
+#endif
+
+// Maximum frame length exchanged with the simulated module, host descriptor included
+#define RSI_SIM_MAX_FRAME_LEN 1600
+
+// Maximum data length delivered in one receive frame
+#define RSI_SIM_MAX_RX_DATA_LEN 1460
+
+/******************************************************
+ * *                    Structures
+ * ******************************************************/
+// Bus traffic counters of the simulated module
+typedef struct rsi_sim_stats_s {
+  // Frames written by host
+  uint32_t tx_frames;
+
+  // Bytes written by host, host descriptors included
+  uint32_t tx_bytes;
+
+  // Frames read by host
+  uint32_t rx_frames;
+
+  // Bytes read by host, host descriptors included
+  uint32_t rx_bytes;
+
+  // Socket data bytes looped back to host
+  uint32_t echo_bytes;
+
+  // Frames dropped since host queue was full
+  uint32_t rx_dropped;
+
+  // Interrupts raised towards host
+  uint32_t interrupts;
+} rsi_sim_stats_t;
+
+/******************************************************
+ * *               Function Declarations
+ * ******************************************************/
+void rsi_sim_reset(void);
+void rsi_sim_mem_wr(uint32_t addr, uint16_t len, uint8_t *buf);
+void rsi_sim_mem_rd(uint32_t addr, uint16_t len, uint8_t *buf);
+void rsi_sim_frame_wr(uint8_t *frame, uint16_t length);
+uint16_t rsi_sim_rx_pending(void);
+uint16_t rsi_sim_frame_rd(uint8_t *frame);
+void rsi_sim_get_stats(rsi_sim_stats_t *stats);
+void rsi_sim_intr_assert(void);
+#endif
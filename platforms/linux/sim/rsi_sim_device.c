@@ -0,0 +1,249 @@
+/*******************************************************************************
+* @file  rsi_sim_device.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_sim_device.c
+ *
+ * @brief SIM DEVICE: Device interface backed by the simulated module
+ *
+ * @section Description
+ * This file takes the place of the SPI device interface layer
+ * (sapi/driver/device_interface/spi). Frames and memory accesses are handed
+ * straight to the firmware model in rsi_sim_fw_model.c instead of being
+ * clocked over a bus, so the driver above runs unchanged.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+#include "rsi_sim.h"
+
+/*==================================================*/
+/**
+ * @brief       Initialize the device interface, simulated module restarts in bootloader.
+ * @param[in]   void
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_spi_iface_init(void)
+{
+  rsi_sim_reset();
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Initialize ULP wakeup, nothing to do for simulated module.
+ * @param[in]   void
+ * @return      void
+ */
+void rsi_ulp_wakeup_init(void)
+{
+  return;
+}
+
+/*====================================================*/
+/**
+ * @brief       Read a frame from the simulated module.
+ * @param[in]   pkt_buffer - Pointer to buffer to which packet has to read, host descriptor included
+ * @return       0 - SUCCESS \n
+ *              -1 - No frame pending
+ */
+int16_t rsi_frame_read(uint8_t *pkt_buffer)
+{
+  if (rsi_sim_frame_rd(pkt_buffer) == 0) {
+    return RSI_ERROR_SPI_BUSY;
+  }
+  return RSI_SUCCESS;
+}
+
+/*====================================================*/
+/**
+ * @brief       Write a frame to the simulated module.
+ * @param[in]   uFrameDscFrame - Frame descriptor
+ * @param[in]   payloadparam   - Pointer to the command payload parameter structure
+ * @param[in]   size_param     - Size of the payload for the command
+ * @return       0 - SUCCESS \n
+ *              -2 - Frame too long
+ */
+int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloadparam, uint16_t size_param)
+{
+  rsi_frame_iovec_t iov;
+
+  iov.buffer = payloadparam;
+  iov.length = size_param;
+
+  return rsi_frame_writev(uFrameDscFrame, &iov, (size_param ? 1 : 0));
+}
+
+/*====================================================*/
+/**
+ * @brief       Write a frame whose payload is scattered over multiple buffers to the simulated module.
+ * @param[in]   uFrameDscFrame - Frame descriptor
+ * @param[in]   iov            - Payload segments
+ * @param[in]   iovcnt         - Number of payload segments
+ * @return       0 - SUCCESS \n
+ *              -2 - Frame too long
+ */
+int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt)
+{
+  uint8_t frame[RSI_SIM_MAX_FRAME_LEN];
+  uint16_t length = RSI_HOST_DESC_LENGTH;
+  uint8_t i;
+
+  memcpy(frame, uFrameDscFrame, RSI_HOST_DESC_LENGTH);
+  for (i = 0; i < iovcnt; i++) {
+    if ((length + iov[i].length) > RSI_SIM_MAX_FRAME_LEN) {
+      return RSI_ERROR_SPI_FAIL;
+    }
+    memcpy(&frame[length], iov[i].buffer, iov[i].length);
+    length += iov[i].length;
+  }
+
+  rsi_sim_frame_wr(frame, length);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Read the interrupt status of the simulated module. RX pending is set while the
+ *              module holds frames for host, buffer full is never reported.
+ * @param[out]  int_status - Pointer to buffer in which status is stored
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_device_interrupt_status(uint8_t *int_status)
+{
+  *int_status = rsi_sim_rx_pending() ? RSI_RX_PKT_PENDING : 0;
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Write to simulated module memory.
+ * @param[in]   addr - Module address
+ * @param[in]   len  - Length to write
+ * @param[in]   dBuf - Data to write
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf)
+{
+  rsi_sim_mem_wr(addr, len, dBuf);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Read from simulated module memory.
+ * @param[in]   addr - Module address
+ * @param[in]   len  - Length to read
+ * @param[out]  dBuf - Buffer to read into
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf)
+{
+  rsi_sim_mem_rd(addr, len, dBuf);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Read an SPI slave register, simulated module has none and reads as zero.
+ * @param[in]   regAddr - Register address
+ * @param[out]  dBuf    - Buffer to read into
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_reg_rd(uint8_t regAddr, uint8_t *dBuf)
+{
+  UNUSED_PARAMETER(regAddr);
+  *dBuf = 0;
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Read a 2 byte SPI slave register, simulated module has none and reads as zero.
+ * @param[in]   regAddr - Register address
+ * @param[out]  dBuf    - Buffer to read into
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_reg_rd2(uint8_t regAddr, uint16_t *dBuf)
+{
+  UNUSED_PARAMETER(regAddr);
+  *dBuf = 0;
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Write an SPI slave register, ignored by simulated module.
+ * @param[in]   regAddr - Register address
+ * @param[in]   dBuf    - Data to write
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_reg_wr(uint8_t regAddr, uint8_t *dBuf)
+{
+  UNUSED_PARAMETER(regAddr);
+  UNUSED_PARAMETER(dBuf);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Set the interrupt mask, ignored by simulated module.
+ * @param[in]   interruptMask - Interrupt mask
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_set_intr_mask(uint8_t interruptMask)
+{
+  UNUSED_PARAMETER(interruptMask);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Set the interrupt type, ignored by simulated module.
+ * @param[in]   interruptMaskVal - Interrupt type
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_set_intr_type(uint32_t interruptMaskVal)
+{
+  UNUSED_PARAMETER(interruptMaskVal);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Clear interrupt, simulated module interrupt follows its pending frames.
+ * @param[in]   interruptClear - Interrupt to clear
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_clear_interrupt(uint8_t interruptClear)
+{
+  UNUSED_PARAMETER(interruptClear);
+  return RSI_SUCCESS;
+}
+
+/*==================================================*/
+/**
+ * @brief       Enable SPI high speed mode, nothing to do for simulated module.
+ * @param[in]   void
+ * @return      0 - SUCCESS
+ */
+int16_t rsi_spi_high_speed_enable(void)
+{
+  return RSI_SUCCESS;
+}
@@ -0,0 +1,720 @@
+/*******************************************************************************
+* @file  rsi_sim_fw_model.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+/**
+ * @file       rsi_sim_fw_model.c
+ *
+ * @brief SIM FW MODEL: In-process model of the module firmware
+ *
+ * @section Description
+ * This file models the module just far enough to run the SAPI driver without
+ * hardware: bootloader handshake, card ready, command responses, socket
+ * create/close and socket data loopback. Every socket echoes the data written
+ * to it back to the host. Bootloader accesses happen before the driver task
+ * runs and frames are only exchanged from the driver task, so the model takes
+ * no locks.
+ *
+ */
+
+/**
+ * Includes
+ */
+#include "rsi_driver.h"
+#include "rsi_sim.h"
+
+/******************************************************
+ * *                      Macros
+ * ******************************************************/
+// First port handed out when a socket is created without a local port
+#define RSI_SIM_EPHEMERAL_PORT_BASE 49152
+
+// TCP MSS reported in socket create response
+#define RSI_SIM_TCP_MSS 1460
+
+// Window size reported in socket create response
+#define RSI_SIM_WINDOW_SIZE 0x4000
+
+// Failure status for requests the model cannot serve, module error codes are not reproduced
+#define RSI_SIM_STATUS_FAILURE 0xFFFF
+
+// BT card ready event, rsi_bt_common.h is only included with BT/BLE enabled
+#define RSI_SIM_BT_CARD_READY 0x0505
+
+// BLE WWO notify buffer info, echoed by module
+#define RSI_SIM_BLE_WWO_BUF_INFO 0x0108
+
+/******************************************************
+ * *                    Structures
+ * ******************************************************/
+// Frame waiting to be read by host, host descriptor included
+typedef struct rsi_sim_frame_s {
+  uint16_t length;
+  uint8_t data[RSI_SIM_MAX_FRAME_LEN];
+} rsi_sim_frame_t;
+
+// Socket state of the simulated module
+typedef struct rsi_sim_socket_s {
+  // Socket is created
+  uint8_t in_use;
+
+  // Data is returned only on read request from host
+  uint8_t synchronous;
+
+  // IP version given at create
+  uint16_t ip_version;
+
+  // Local port
+  uint16_t module_port;
+
+  // Remote port, reported in receive frames
+  uint16_t dest_port;
+
+  // Remote IP, reported in receive frames
+  uint8_t dest_ip[RSI_IP_ADDRESS_LEN * 4];
+
+  // Bytes host asked for in a pending read request, 0 if none
+  uint32_t read_requested;
+
+  // Echo ring
+  uint16_t head;
+  uint16_t count;
+  uint8_t buffer[RSI_SIM_SOCKET_BUFFER_LEN];
+} rsi_sim_socket_t;
+
+// Simulated module control block
+typedef struct rsi_sim_cb_s {
+  // Bootloader host interaction register as read by host
+  uint16_t host_intf_reg_out;
+
+  // Firmware is loaded and processes frames
+  uint8_t fw_running;
+
+  // Next port handed out to sockets created without a local port
+  uint16_t next_port;
+
+  // Frames waiting to be read by host
+  rsi_sim_frame_t rx_queue[RSI_SIM_RX_QUEUE_DEPTH];
+  uint16_t rx_head;
+  uint16_t rx_count;
+
+  rsi_sim_socket_t sockets[RSI_SIM_MAX_SOCKETS];
+
+  rsi_sim_stats_t stats;
+} rsi_sim_cb_t;
+
+/******************************************************
+ * *                 Global Variables
+ * ******************************************************/
+static rsi_sim_cb_t rsi_sim_cb;
+
+static const uint8_t rsi_sim_mac_addr[6]   = { 0x00, 0x23, 0xA7, 0x00, 0x00, 0x01 };
+static const uint8_t rsi_sim_ipv4_addr[4]  = { 192, 168, 10, 101 };
+static const uint8_t rsi_sim_netmask[4]    = { 255, 255, 255, 0 };
+static const uint8_t rsi_sim_gateway[4]    = { 192, 168, 10, 1 };
+static const char rsi_sim_fw_version[]     = "1610.2.0.0.0000";
+
+/*==============================================*/
+/**
+ * @brief       Queue a frame for host and raise interrupt. Payload is given in two parts so that
+ *              receive header and socket data need not be joined beforehand.
+ * @param[in]   queue_no   - Queue number
+ * @param[in]   frame_type - Frame/response type
+ * @param[in]   status     - Status reported in host descriptor
+ * @param[in]   hdr        - First part of payload
+ * @param[in]   hdr_len    - Length of first part
+ * @param[in]   data       - Second part of payload
+ * @param[in]   data_len   - Length of second part
+ * @return      0  - Success \n
+ *              -1 - Host queue full, frame dropped
+ */
+static int32_t rsi_sim_queue_frame(uint8_t queue_no,
+                                   uint16_t frame_type,
+                                   uint16_t status,
+                                   const uint8_t *hdr,
+                                   uint16_t hdr_len,
+                                   const uint8_t *data,
+                                   uint16_t data_len)
+{
+  rsi_sim_frame_t *frame;
+  uint16_t payload_len = hdr_len + data_len;
+
+  if ((rsi_sim_cb.rx_count == RSI_SIM_RX_QUEUE_DEPTH)
+      || (payload_len > (RSI_SIM_MAX_FRAME_LEN - RSI_HOST_DESC_LENGTH))) {
+    rsi_sim_cb.stats.rx_dropped++;
+    return -1;
+  }
+
+  frame = &rsi_sim_cb.rx_queue[(rsi_sim_cb.rx_head + rsi_sim_cb.rx_count) % RSI_SIM_RX_QUEUE_DEPTH];
+
+  // Fill host descriptor
+  memset(frame->data, 0, RSI_HOST_DESC_LENGTH);
+  rsi_uint16_to_2bytes(frame->data, (payload_len & 0xFFF));
+  frame->data[1] |= (queue_no << 4);
+  rsi_uint16_to_2bytes(&frame->data[2], frame_type);
+  rsi_uint16_to_2bytes(&frame->data[RSI_STATUS_OFFSET], status);
+
+  if (hdr_len) {
+    memcpy(&frame->data[RSI_HOST_DESC_LENGTH], hdr, hdr_len);
+  }
+  if (data_len) {
+    memcpy(&frame->data[RSI_HOST_DESC_LENGTH + hdr_len], data, data_len);
+  }
+  frame->length = RSI_HOST_DESC_LENGTH + payload_len;
+
+  rsi_sim_cb.rx_count++;
+
+  // Tell host a frame is pending
+  rsi_sim_cb.stats.interrupts++;
+  rsi_sim_intr_assert();
+
+  return 0;
+}
+
+/*==============================================*/
+/**
+ * @brief       Send buffered socket data to host while socket may receive. Asynchronous sockets get
+ *              everything buffered, synchronous sockets one frame per read request.
+ * @param[in]   sock_index - Socket index
+ * @return      void
+ */
+static void rsi_sim_socket_deliver(uint16_t sock_index)
+{
+  rsi_sim_socket_t *sock = &rsi_sim_cb.sockets[sock_index];
+  rsi_rsp_socket_recv_t recv;
+  uint8_t chunk[RSI_SIM_MAX_RX_DATA_LEN];
+  uint32_t length;
+  uint16_t first;
+
+  while (sock->in_use && sock->count && (!sock->synchronous || sock->read_requested)) {
+    if (rsi_sim_cb.rx_count == RSI_SIM_RX_QUEUE_DEPTH) {
+      // Host queue is full, retry once host has read a frame
+      return;
+    }
+
+    length = (sock->count < RSI_SIM_MAX_RX_DATA_LEN) ? sock->count : RSI_SIM_MAX_RX_DATA_LEN;
+    if (sock->synchronous && (sock->read_requested < length)) {
+      length = sock->read_requested;
+    }
+
+    // Unwrap ring into contiguous chunk
+    first = RSI_SIM_SOCKET_BUFFER_LEN - sock->head;
+    if (first >= length) {
+      memcpy(chunk, &sock->buffer[sock->head], length);
+    } else {
+      memcpy(chunk, &sock->buffer[sock->head], first);
+      memcpy(&chunk[first], sock->buffer, length - first);
+    }
+
+    memset(&recv, 0, sizeof(rsi_rsp_socket_recv_t));
+    rsi_uint16_to_2bytes(recv.ip_version, sock->ip_version);
+    rsi_uint16_to_2bytes(recv.socket_id, (sock_index + 1));
+    rsi_uint32_to_4bytes(recv.length, length);
+    rsi_uint16_to_2bytes(recv.offset, sizeof(rsi_rsp_socket_recv_t));
+    rsi_uint16_to_2bytes(recv.dest_port, sock->dest_port);
+    memcpy(recv.dest_ip_addr.ipv6_address, sock->dest_ip, sizeof(sock->dest_ip));
+#ifdef RSI_PROCESS_MAX_RX_DATA
+    // Whole answer fits in one frame, tell host whether more can be read
+    recv.end_of_the_data   = 1;
+    recv.more_data_pending = (sock->count > length);
+#endif
+
+    rsi_sim_queue_frame(RSI_WLAN_DATA_Q,
+                        0,
+                        RSI_SUCCESS,
+                        (uint8_t *)&recv,
+                        sizeof(rsi_rsp_socket_recv_t),
+                        chunk,
+                        length);
+
+    sock->head = (sock->head + length) % RSI_SIM_SOCKET_BUFFER_LEN;
+    sock->count -= length;
+    rsi_sim_cb.stats.echo_bytes += length;
+
+    if (sock->synchronous) {
+      // One frame answers one read request
+      sock->read_requested = 0;
+    }
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Handle socket create request.
+ * @param[in]   req - Socket create request
+ * @return      void
+ */
+static void rsi_sim_socket_create(rsi_req_socket_t *req)
+{
+  rsi_rsp_socket_create_t rsp;
+  rsi_sim_socket_t *sock = NULL;
+  uint16_t i;
+
+  for (i = 0; i < RSI_SIM_MAX_SOCKETS; i++) {
+    if (!rsi_sim_cb.sockets[i].in_use) {
+      sock = &rsi_sim_cb.sockets[i];
+      break;
+    }
+  }
+
+  memset(&rsp, 0, sizeof(rsi_rsp_socket_create_t));
+  memcpy(rsp.ip_version, req->ip_version, 2);
+  memcpy(rsp.socket_type, req->socket_type, 2);
+  memcpy(rsp.module_port, req->module_socket, 2);
+  memcpy(rsp.dst_port, req->dest_socket, 2);
+  memcpy(rsp.dest_ip_addr.ipv6_addr, req->dest_ip_addr.ipv6_address, sizeof(rsp.dest_ip_addr));
+
+  if (sock == NULL) {
+    rsi_sim_queue_frame(RSI_WLAN_MGMT_Q,
+                        RSI_WLAN_RSP_SOCKET_CREATE,
+                        RSI_SIM_STATUS_FAILURE,
+                        (uint8_t *)&rsp,
+                        sizeof(rsi_rsp_socket_create_t),
+                        NULL,
+                        0);
+    return;
+  }
+
+  memset(sock, 0, sizeof(rsi_sim_socket_t));
+  sock->in_use      = 1;
+  sock->synchronous = (req->socket_bitmap & BIT(0)) ? 1 : 0;
+  sock->ip_version  = rsi_bytes2R_to_uint16(req->ip_version);
+  sock->module_port = rsi_bytes2R_to_uint16(req->module_socket);
+  sock->dest_port   = rsi_bytes2R_to_uint16(req->dest_socket);
+  memcpy(sock->dest_ip, req->dest_ip_addr.ipv6_address, sizeof(sock->dest_ip));
+
+  if (sock->module_port == 0) {
+    sock->module_port = rsi_sim_cb.next_port++;
+  }
+
+  rsi_uint16_to_2bytes(rsp.socket_id, (i + 1));
+  rsi_uint16_to_2bytes(rsp.module_port, sock->module_port);
+  if (sock->ip_version == 4) {
+    memcpy(rsp.module_ip_addr.ipv4_addr, rsi_sim_ipv4_addr, 4);
+  }
+  rsi_uint16_to_2bytes(rsp.mss, RSI_SIM_TCP_MSS);
+  rsi_uint32_to_4bytes(rsp.window_size, RSI_SIM_WINDOW_SIZE);
+
+  rsi_sim_queue_frame(RSI_WLAN_MGMT_Q,
+                      RSI_WLAN_RSP_SOCKET_CREATE,
+                      RSI_SUCCESS,
+                      (uint8_t *)&rsp,
+                      sizeof(rsi_rsp_socket_create_t),
+                      NULL,
+                      0);
+}
+
+/*==============================================*/
+/**
+ * @brief       Handle socket close request.
+ * @param[in]   req - Socket close request
+ * @return      void
+ */
+static void rsi_sim_socket_close(rsi_req_socket_close_t *req)
+{
+  rsi_rsp_socket_close_t rsp;
+  uint16_t sock_id = rsi_bytes2R_to_uint16(req->socket_id);
+
+  memset(&rsp, 0, sizeof(rsi_rsp_socket_close_t));
+  memcpy(rsp.socket_id, req->socket_id, 2);
+  memcpy(rsp.port_number, req->port_number, 2);
+
+  if ((sock_id >= 1) && (sock_id <= RSI_SIM_MAX_SOCKETS)) {
+    rsi_sim_cb.sockets[sock_id - 1].in_use = 0;
+  }
+
+  rsi_sim_queue_frame(RSI_WLAN_MGMT_Q,
+                      RSI_WLAN_RSP_SOCKET_CLOSE,
+                      RSI_SUCCESS,
+                      (uint8_t *)&rsp,
+                      sizeof(rsi_rsp_socket_close_t),
+                      NULL,
+                      0);
+}
+
+/*==============================================*/
+/**
+ * @brief       Handle socket select request. Answered at once: sockets holding echo data are readable and
+ *              every socket is writable, nothing else can become ready while host waits.
+ * @param[in]   req - Socket select request
+ * @return      void
+ */
+static void rsi_sim_socket_select(rsi_req_socket_select_t *req)
+{
+  rsi_rsp_socket_select_t rsp;
+  uint32_t sock_bit;
+  uint16_t i;
+
+  memset(&rsp, 0, sizeof(rsi_rsp_socket_select_t));
+  rsp.select_id = req->select_id;
+
+  for (i = 0; i < RSI_SIM_MAX_SOCKETS; i++) {
+    if (!rsi_sim_cb.sockets[i].in_use) {
+      continue;
+    }
+    // Socket IDs handed to host start from 1
+    sock_bit = BIT((i + 1));
+    if ((req->rsi_read_fds.fd_array[0] & sock_bit) && rsi_sim_cb.sockets[i].count) {
+      rsp.rsi_read_fds.fd_array[0] |= sock_bit;
+    }
+    if (req->rsi_write_fds.fd_array[0] & sock_bit) {
+      rsp.rsi_write_fds.fd_array[0] |= sock_bit;
+    }
+  }
+
+  rsi_sim_queue_frame(RSI_WLAN_MGMT_Q,
+                      RSI_WLAN_RSP_SELECT_REQUEST,
+                      RSI_SUCCESS,
+                      (uint8_t *)&rsp,
+                      sizeof(rsi_rsp_socket_select_t),
+                      NULL,
+                      0);
+}
+
+/*==============================================*/
+/**
+ * @brief       Handle a frame written on WLAN management queue. Common commands share this queue.
+ * @param[in]   frame_type - Command type
+ * @param[in]   payload    - Command payload
+ * @param[in]   length     - Payload length
+ * @return      void
+ */
+static void rsi_sim_process_mgmt(uint8_t frame_type, uint8_t *payload, uint16_t length)
+{
+  rsi_rsp_ipv4_parmas_t ipv4;
+  rsi_req_socket_read_t *read;
+  rsi_opermode_t *opermode;
+  uint16_t sock_id;
+
+  switch (frame_type) {
+    case RSI_COMMON_REQ_OPERMODE:
+      rsi_sim_queue_frame(RSI_WLAN_MGMT_Q, frame_type, RSI_SUCCESS, NULL, 0, NULL, 0);
+
+      // BT/BLE coex modes bring up BT stack which reports its own card ready
+      opermode = (rsi_opermode_t *)payload;
+      if ((length >= 4) && (rsi_bytes4R_to_uint32(opermode->opermode) >> 16) & (BIT(2) | BIT(3))) {
+        rsi_sim_queue_frame(RSI_BT_Q, RSI_SIM_BT_CARD_READY, RSI_SUCCESS, NULL, 0, NULL, 0);
+      }
+      break;
+
+    case RSI_COMMON_REQ_FW_VERSION:
+      rsi_sim_queue_frame(RSI_WLAN_MGMT_Q,
+                          frame_type,
+                          RSI_SUCCESS,
+                          (const uint8_t *)rsi_sim_fw_version,
+                          sizeof(rsi_sim_fw_version),
+                          NULL,
+                          0);
+      break;
+
+    case RSI_WLAN_REQ_MAC_ADDRESS:
+      rsi_sim_queue_frame(RSI_WLAN_MGMT_Q, frame_type, RSI_SUCCESS, rsi_sim_mac_addr, 6, NULL, 0);
+      break;
+
+    case RSI_WLAN_REQ_IPCONFV4:
+      memcpy(ipv4.macAddr, rsi_sim_mac_addr, 6);
+      memcpy(ipv4.ipaddr, rsi_sim_ipv4_addr, 4);
+      memcpy(ipv4.netmask, rsi_sim_netmask, 4);
+      memcpy(ipv4.gateway, rsi_sim_gateway, 4);
+      rsi_sim_queue_frame(RSI_WLAN_MGMT_Q,
+                          frame_type,
+                          RSI_SUCCESS,
+                          (uint8_t *)&ipv4,
+                          sizeof(rsi_rsp_ipv4_parmas_t),
+                          NULL,
+                          0);
+      break;
+
+    case RSI_WLAN_REQ_SOCKET_CREATE:
+      rsi_sim_socket_create((rsi_req_socket_t *)payload);
+      break;
+
+    case RSI_WLAN_REQ_SOCKET_CLOSE:
+      rsi_sim_socket_close((rsi_req_socket_close_t *)payload);
+      break;
+
+    case RSI_WLAN_REQ_SOCKET_READ_DATA:
+      // No response, data frame answers the request
+      read    = (rsi_req_socket_read_t *)payload;
+      sock_id = read->socket_id;
+      if ((sock_id >= 1) && (sock_id <= RSI_SIM_MAX_SOCKETS)) {
+        rsi_sim_cb.sockets[sock_id - 1].read_requested = rsi_bytes4R_to_uint32(read->requested_bytes);
+        rsi_sim_socket_deliver(sock_id - 1);
+      }
+      break;
+
+    case RSI_WLAN_REQ_SELECT_REQUEST:
+      rsi_sim_socket_select((rsi_req_socket_select_t *)payload);
+      break;
+
+    default:
+      // Everything else succeeds without payload
+      rsi_sim_queue_frame(RSI_WLAN_MGMT_Q, frame_type, RSI_SUCCESS, NULL, 0, NULL, 0);
+      break;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Handle a frame written on WLAN data queue, data is looped back on the same socket.
+ * @param[in]   payload - Socket send request followed by data
+ * @param[in]   length  - Payload length
+ * @return      void
+ */
+static void rsi_sim_process_data(uint8_t *payload, uint16_t length)
+{
+  rsi_req_socket_send_t *send = (rsi_req_socket_send_t *)payload;
+  rsi_sim_socket_t *sock;
+  uint16_t sock_id     = send->socket_id[0];
+  uint16_t data_offset = rsi_bytes2R_to_uint16(send->data_offset);
+  uint32_t data_len    = rsi_bytes4R_to_uint32(send->length);
+  uint16_t tail;
+  uint16_t first;
+
+  if ((sock_id < 1) || (sock_id > RSI_SIM_MAX_SOCKETS) || (data_offset > length)) {
+    return;
+  }
+  sock = &rsi_sim_cb.sockets[sock_id - 1];
+  if (!sock->in_use) {
+    return;
+  }
+
+  if (data_len > (uint32_t)(length - data_offset)) {
+    data_len = length - data_offset;
+  }
+
+  // Datagrams may come from anywhere, answer to where they were sent
+  if (rsi_bytes2R_to_uint16(send->dest_port)) {
+    sock->dest_port = rsi_bytes2R_to_uint16(send->dest_port);
+    memcpy(sock->dest_ip, send->dest_ip_addr.ipv6_address, sizeof(sock->dest_ip));
+  }
+
+  // Whatever does not fit in echo ring is lost
+  if (data_len > (uint32_t)(RSI_SIM_SOCKET_BUFFER_LEN - sock->count)) {
+    rsi_sim_cb.stats.rx_dropped++;
+    data_len = RSI_SIM_SOCKET_BUFFER_LEN - sock->count;
+  }
+
+  tail  = (sock->head + sock->count) % RSI_SIM_SOCKET_BUFFER_LEN;
+  first = RSI_SIM_SOCKET_BUFFER_LEN - tail;
+  if (first >= data_len) {
+    memcpy(&sock->buffer[tail], &payload[data_offset], data_len);
+  } else {
+    memcpy(&sock->buffer[tail], &payload[data_offset], first);
+    memcpy(sock->buffer, &payload[data_offset + first], data_len - first);
+  }
+  sock->count += data_len;
+
+  rsi_sim_socket_deliver(sock_id - 1);
+}
+
+/*==============================================*/
+/**
+ * @brief       Handle a frame written on BT queue. Every command is acknowledged without payload,
+ *              apart from WWO buffer info which is echoed like the module does.
+ * @param[in]   rsp_type - Command type
+ * @param[in]   payload  - Command payload
+ * @param[in]   length   - Payload length
+ * @return      void
+ */
+static void rsi_sim_process_bt(uint16_t rsp_type, uint8_t *payload, uint16_t length)
+{
+  if (rsp_type != RSI_SIM_BLE_WWO_BUF_INFO) {
+    length = 0;
+  }
+  rsi_sim_queue_frame(RSI_BT_Q, rsp_type, RSI_SUCCESS, payload, length, NULL, 0);
+}
+
+/*==============================================*/
+/**
+ * @brief       Reset simulated module to bootloader, dropping all frames and sockets.
+ * @param[in]   void
+ * @return      void
+ */
+void rsi_sim_reset(void)
+{
+  memset(&rsi_sim_cb, 0, sizeof(rsi_sim_cb_t));
+  rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID | RSI_BOOTLOADER_VERSION_1P1;
+  rsi_sim_cb.next_port         = RSI_SIM_EPHEMERAL_PORT_BASE;
+}
+
+/*==============================================*/
+/**
+ * @brief       Write module memory. Only bootloader host interaction registers are modelled.
+ * @param[in]   addr - Module address
+ * @param[in]   len  - Length to write
+ * @param[in]   buf  - Data to write
+ * @return      void
+ */
+void rsi_sim_mem_wr(uint32_t addr, uint16_t len, uint8_t *buf)
+{
+  uint16_t value;
+  uint8_t cmd;
+
+  if (len < 2) {
+    return;
+  }
+  value = rsi_bytes2R_to_uint16(buf);
+
+  if (addr == RSI_HOST_INTF_REG_OUT) {
+    rsi_sim_cb.host_intf_reg_out = value;
+    return;
+  }
+  if ((addr != RSI_HOST_INTF_REG_IN)
+      || (((value & 0xFF00) != RSI_HOST_INTERACT_REG_VALID) && ((value & 0xFF00) != RSI_HOST_INTERACT_REG_VALID_FW))) {
+    return;
+  }
+
+  cmd = value & 0xFF;
+  switch (cmd) {
+    case LOAD_NWP_FW:
+    case LOAD_DEFAULT_NWP_FW_ACTIVE_LOW:
+      rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID_FW | RSI_CHECKSUM_SUCCESS;
+      rsi_sim_cb.fw_running        = 1;
+      rsi_sim_queue_frame(RSI_WLAN_MGMT_Q, RSI_COMMON_RSP_CARDREADY, RSI_SUCCESS, NULL, 0, NULL, 0);
+      break;
+
+    case BURN_NWP_FW:
+      rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID | RSI_SEND_RPS_FILE;
+      break;
+
+    case RSI_PING_AVAIL:
+      rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID | RSI_PONG_AVAIL;
+      break;
+
+    case RSI_PONG_AVAIL:
+      rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID | RSI_PING_AVAIL;
+      break;
+
+    case RSI_EOF_REACHED:
+      rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID | RSI_FWUP_SUCCESSFUL;
+      break;
+
+    default:
+      // Acknowledge other options as accepted
+      rsi_sim_cb.host_intf_reg_out = RSI_HOST_INTERACT_REG_VALID | cmd;
+      break;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Read module memory. Unmodelled addresses read as zero.
+ * @param[in]   addr - Module address
+ * @param[in]   len  - Length to read
+ * @param[out]  buf  - Buffer to read into
+ * @return      void
+ */
+void rsi_sim_mem_rd(uint32_t addr, uint16_t len, uint8_t *buf)
+{
+  memset(buf, 0, len);
+  if ((addr == RSI_HOST_INTF_REG_OUT) && (len >= 2)) {
+    rsi_uint16_to_2bytes(buf, rsi_sim_cb.host_intf_reg_out);
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Process a frame written by host.
+ * @param[in]   frame  - Host descriptor followed by payload
+ * @param[in]   length - Total frame length
+ * @return      void
+ */
+void rsi_sim_frame_wr(uint8_t *frame, uint16_t length)
+{
+  uint16_t payload_len;
+  uint8_t queue_no;
+
+  rsi_sim_cb.stats.tx_frames++;
+  rsi_sim_cb.stats.tx_bytes += length;
+
+  if (!rsi_sim_cb.fw_running || (length < RSI_HOST_DESC_LENGTH)) {
+    return;
+  }
+
+  payload_len = rsi_bytes2R_to_uint16(frame) & 0xFFF;
+  queue_no    = (frame[1] & 0xF0) >> 4;
+  if (payload_len > (length - RSI_HOST_DESC_LENGTH)) {
+    payload_len = length - RSI_HOST_DESC_LENGTH;
+  }
+
+  switch (queue_no) {
+    case RSI_WLAN_MGMT_Q:
+      rsi_sim_process_mgmt(frame[2], &frame[RSI_HOST_DESC_LENGTH], payload_len);
+      break;
+    case RSI_WLAN_DATA_Q:
+      rsi_sim_process_data(&frame[RSI_HOST_DESC_LENGTH], payload_len);
+      break;
+    case RSI_BT_Q:
+      rsi_sim_process_bt(rsi_bytes2R_to_uint16(&frame[2]), &frame[RSI_HOST_DESC_LENGTH], payload_len);
+      break;
+    default:
+      break;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Get number of frames waiting to be read by host.
+ * @param[in]   void
+ * @return      Number of pending frames
+ */
+uint16_t rsi_sim_rx_pending(void)
+{
+  return rsi_sim_cb.rx_count;
+}
+
+/*==============================================*/
+/**
+ * @brief       Read the oldest pending frame. Freed queue space is refilled from socket echo rings.
+ * @param[out]  frame - Buffer of at least RSI_SIM_MAX_FRAME_LEN bytes
+ * @return      Frame length, 0 if no frame is pending
+ */
+uint16_t rsi_sim_frame_rd(uint8_t *frame)
+{
+  rsi_sim_frame_t *head;
+  uint16_t length;
+  uint16_t i;
+
+  if (rsi_sim_cb.rx_count == 0) {
+    return 0;
+  }
+
+  head   = &rsi_sim_cb.rx_queue[rsi_sim_cb.rx_head];
+  length = head->length;
+  memcpy(frame, head->data, length);
+  rsi_sim_cb.rx_head = (rsi_sim_cb.rx_head + 1) % RSI_SIM_RX_QUEUE_DEPTH;
+  rsi_sim_cb.rx_count--;
+
+  rsi_sim_cb.stats.rx_frames++;
+  rsi_sim_cb.stats.rx_bytes += length;
+
+  for (i = 0; i < RSI_SIM_MAX_SOCKETS; i++) {
+    rsi_sim_socket_deliver(i);
+  }
+
+  return length;
+}
+
+/*==============================================*/
+/**
+ * @brief       Get bus traffic counters of simulated module.
+ * @param[out]  stats - Counters
+ * @return      void
+ */
+void rsi_sim_get_stats(rsi_sim_stats_t *stats)
+{
+  memcpy(stats, &rsi_sim_cb.stats, sizeof(rsi_sim_stats_t));
+}
@@ -39,6 +39,8 @@
 extern SPI_HandleTypeDef hspi1;
 extern uint8_t receive_completed,transmit_completed;
 volatile uint8_t  dma_tx_rx_completed;
+//! Completion handler of asynchronous transfer in progress
+static void (*volatile spi_transfer_done)(void);
 /**
  * Global Variables
  */
@@ -134,10 +136,81 @@ int16_t rsi_spi_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_l
 				return 0;
 }
 
+/*==================================================================*/
+/**
+ * @fn         int16_t rsi_spi_transfer_async(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode, void (*transfer_done)(void))
+ * @param[in]  uint8_t *tx_buff, pointer to the buffer with the data to be transfered
+ * @param[in]  uint8_t *rx_buff, pointer to the buffer to store the data received
+ * @param[in]  uint16_t transfer_length, Number of bytes to send and receive
+ * @param[in]  uint8_t mode, To indicate mode 8 BIT/32 BIT mode transfers.
+ * @param[in]  transfer_done, called from interrupt context once the transfer is completed
+ * @param[out] None
+ * @return     0, 0=success, transfer is started
+ * @section description  
+ * This API is used to start a DMA transfer to/from the Wi-Fi module through the SPI interface
+ * and return without waiting for it. Nonzero return tells the caller to use rsi_spi_transfer().
+ */
+int16_t rsi_spi_transfer_async(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode, void (*transfer_done)(void))
+{
+	UNUSED_PARAMETER(mode);//This statement is added only to resolve compilation warning, value is unchanged
+#if DMA_ENABLED
+	if(tx_buff == NULL)
+	{
+		tx_buff = (uint8_t *)&dummy;
+	}
+	else if(rx_buff == NULL)
+	{
+		rx_buff = (uint8_t *)&dummy;
+	}
+	spi_transfer_done = transfer_done;
+	if(HAL_SPI_TransmitReceive_DMA(&hspi1,tx_buff,rx_buff,transfer_length) != HAL_OK)
+	{
+		spi_transfer_done = NULL;
+		return -1;
+	}
+	return 0;
+#else
+	UNUSED_PARAMETER(tx_buff);//This statement is added only to resolve compilation warning, value is unchanged
+	UNUSED_PARAMETER(rx_buff);//This statement is added only to resolve compilation warning, value is unchanged
+	UNUSED_PARAMETER(transfer_length);//This statement is added only to resolve compilation warning, value is unchanged
+	UNUSED_PARAMETER(transfer_done);//This statement is added only to resolve compilation warning, value is unchanged
+	return -1;
+#endif
+}
+
+/*==================================================================*/
+/**
+ * @fn         void rsi_spi_transfer_abort(void)
+ * @param[out] None
+ * @return     None
+ * @section description  
+ * This API is used to abort an asynchronous transfer started by rsi_spi_transfer_async() that did not
+ * complete in time. Completion handler is not called once this returns.
+ */
+void rsi_spi_transfer_abort(void)
+{
+#if DMA_ENABLED
+	//! Stop DMA first, completion can not be reported after this
+	HAL_SPI_Abort(&hspi1);
+	spi_transfer_done = NULL;
+	dma_tx_rx_completed = 0;
+#endif
+}
+
  void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
 	{
+	 void (*transfer_done)(void) = spi_transfer_done;
 	 UNUSED_PARAMETER(hspi);//This statement is added only to resolve compilation warning, value is unchanged
-		dma_tx_rx_completed=1;
+		if(transfer_done != NULL)
+		{
+			//! Asynchronous transfer, wake up the waiting task
+			spi_transfer_done = NULL;
+			transfer_done();
+		}
+		else
+		{
+			dma_tx_rx_completed=1;
+		}
 	}
 
 #endif
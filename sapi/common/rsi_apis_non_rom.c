@@ -25,6 +25,7 @@ global_cb_t *global_cb;
 global_cb_t *global_cb_p;
 rsi_wlan_cb_non_rom_t *rsi_wlan_cb_non_rom;
 rsi_socket_select_info_t *rsi_socket_select_info;
+rsi_socket_epoll_info_t *rsi_socket_epoll_info;
 struct rom_apis_s *rom_apis;
 #ifndef ROM_WIRELESS
 const struct ROM_WL_API_S api_wl_s = {
@@ -137,8 +138,8 @@ void rom_init(void)
   global_cb_p->rom_apis_p->rsi_critical_section_exit  = rsi_critical_section_exit;
   global_cb_p->rom_apis_p->rsi_semaphore_wait         = rsi_semaphore_wait;
   global_cb_p->rom_apis_p->rsi_semaphore_post         = rsi_semaphore_post;
-#ifdef RSI_M4_INTERFACE
   global_cb_p->rom_apis_p->rsi_semaphore_post_from_isr = rsi_semaphore_post_from_isr;
+#ifdef RSI_M4_INTERFACE
   global_cb_p->rom_apis_p->rsi_mask_ta_interrupt       = rsi_mask_ta_interrupt;
   global_cb_p->rom_apis_p->rsi_unmask_ta_interrupt     = rsi_unmask_ta_interrupt;
 #endif
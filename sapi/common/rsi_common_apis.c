@@ -31,6 +31,8 @@
 #include "rsi_wlan_non_rom.h"
 extern rsi_socket_info_non_rom_t *rsi_socket_pool_non_rom;
 extern rsi_socket_select_info_t *rsi_socket_select_info;
+extern rsi_socket_epoll_info_t *rsi_socket_epoll_info;
+extern uint8_t *rsi_socket_rx_ring;
 #ifdef PROCESS_SCAN_RESULTS_AT_HOST
 extern struct wpa_scan_results_arr *scan_results_array;
 #endif
@@ -94,14 +96,179 @@ void rsi_common_set_status(int32_t status)
 
 /** @} */
 uint8_t *buffer_addr = NULL;
+// Driver configuration applied by rsi_driver_init(), kept across driver re-initialization
+rsi_driver_config_t rsi_driver_config;
+uint8_t rsi_driver_config_valid = 0;
+
+// Packet length and compile time packet count of each driver packet pool, indexed by rsi_pkt_pool_class_t
+static const uint16_t rsi_driver_pool_pkt_len[RSI_PKT_POOL_MAX] = {
+  RSI_WLAN_CMD_LEN,      RSI_WLAN_CMD_LEN, RSI_COMMON_CMD_LEN,   RSI_BT_COMMON_CMD_LEN,
+  RSI_BT_CLASSIC_CMD_LEN, RSI_BLE_CMD_LEN,  RSI_DRIVER_RX_PKT_LEN
+};
+static const uint16_t rsi_driver_default_pool_pkt_count[RSI_PKT_POOL_MAX] = {
+  RSI_WLAN_DATA_TX_POOL_PKT_COUNT,  RSI_WLAN_TX_POOL_PKT_COUNT, RSI_COMMON_TX_POOL_PKT_COUNT,
+  RSI_BT_COMMON_TX_POOL_PKT_COUNT,  RSI_BT_CLASSIC_TX_POOL_PKT_COUNT, RSI_BLE_TX_POOL_PKT_COUNT,
+  RSI_DRIVER_RX_POOL_PKT_COUNT
+};
+
+/*==============================================*/
+/**
+ * @brief      Check whether a driver packet pool is part of this build. This is a non-blocking API.
+ * @param[in]  pool_class - Packet pool, one of rsi_pkt_pool_class_t
+ * @return     1 - Pool is used \n
+ *             0 - Pool is not used
+ */
+/// @private
+static uint8_t rsi_driver_pool_in_use(uint8_t pool_class)
+{
+  switch (pool_class) {
+#ifdef RSI_WLAN_ENABLE
+    case RSI_PKT_POOL_WLAN_DATA:
+#endif
+    case RSI_PKT_POOL_WLAN_MGMT:
+    case RSI_PKT_POOL_COMMON:
+#if (defined RSI_BT_ENABLE || defined RSI_BLE_ENABLE || defined RSI_PROP_PROTOCOL_ENABLE)
+    case RSI_PKT_POOL_BT_COMMON:
+#endif
+#ifdef RSI_BT_ENABLE
+    case RSI_PKT_POOL_BT_CLASSIC:
+#endif
+#ifdef RSI_BLE_ENABLE
+    case RSI_PKT_POOL_BLE:
+#endif
+#if !((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
+    case RSI_PKT_POOL_RX:
+#endif
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Get memory needed for a driver packet pool with the given packet count. This is a non-blocking API.
+ * @param[in]  pool_class - Packet pool, one of rsi_pkt_pool_class_t
+ * @param[in]  pkt_count  - Number of packets in the pool
+ * @return     Pool size in bytes, 0 if pool is not used
+ */
+/// @private
+static uint32_t rsi_driver_pool_size(uint8_t pool_class, uint16_t pkt_count)
+{
+  if (!rsi_driver_pool_in_use(pool_class) || (pkt_count == 0)) {
+    return 0;
+  }
+  return ((RSI_PKT_POOL_SIZE(rsi_driver_pool_pkt_len[pool_class], pkt_count) + 3) & ~3);
+}
+
+/*==============================================*/
+/**
+ * @brief      Create a driver packet pool from the buffer as per driver configuration. This is a non-blocking API.
+ * @param[in]  pool_class - Packet pool, one of rsi_pkt_pool_class_t
+ * @param[in]  pool_cb    - Packet pool to initialize
+ * @param[in]  buffer     - Buffer to carve the pool from
+ * @return     Buffer pointer past the pool
+ */
+/// @private
+static uint8_t *rsi_driver_pkt_pool_init(uint8_t pool_class, rsi_pkt_pool_t *pool_cb, uint8_t *buffer)
+{
+  uint32_t pool_size = rsi_driver_pool_size(pool_class, rsi_driver_config.pool_pkt_count[pool_class]);
+
+  if (pool_size == 0) {
+    return buffer;
+  }
+  if (rsi_driver_config.pool_lock_free[pool_class]) {
+    rsi_pkt_pool_init_lock_free(pool_cb, buffer, pool_size, rsi_driver_pool_pkt_len[pool_class]);
+  } else {
+    rsi_pkt_pool_init(pool_cb, buffer, pool_size, rsi_driver_pool_pkt_len[pool_class]);
+  }
+  if ((rsi_driver_config.pool_watermark_cb != NULL)
+      && (rsi_driver_config.pool_high_watermark[pool_class] > rsi_driver_config.pool_low_watermark[pool_class])) {
+    rsi_pkt_pool_set_watermarks(pool_cb,
+                                rsi_driver_config.pool_low_watermark[pool_class],
+                                rsi_driver_config.pool_high_watermark[pool_class],
+                                rsi_driver_config.pool_watermark_cb);
+  }
+  return buffer + pool_size;
+}
+
 int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
 {
+  return rsi_driver_init_with_config(buffer, length, NULL);
+}
+/** @addtogroup COMMON 
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief      Fill driver configuration with the compile time defaults. This is a non-blocking API.
+ * @param[out] config - Driver configuration to fill
+ * @return     void
+ */
+
+void rsi_driver_config_init(rsi_driver_config_t *config)
+{
+  uint8_t i;
+
+  memset(config, 0, sizeof(rsi_driver_config_t));
+  config->tx_arb_policy = RSI_TX_ARB_POLICY;
+  for (i = 0; i < RSI_TX_ARB_MAX_Q; i++) {
+    config->tx_arb_quantum[i]           = RSI_TX_ARB_QUANTUM;
+    config->tx_arb_latency_target_ms[i] = RSI_TX_ARB_LATENCY_TARGET_MS;
+  }
+  for (i = 0; i < RSI_PKT_POOL_MAX; i++) {
+    config->pool_pkt_count[i] = rsi_driver_default_pool_pkt_count[i];
+    config->pool_lock_free[i] = (RSI_PKT_POOL_LOCK_FREE_MAP & BIT(i)) ? 1 : 0;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Initialize WiSeConnect driver with the given driver configuration. This is a non-blocking API.
+ *             Same as \ref rsi_driver_init() apart from the configuration, which stays in effect for later
+ *             \ref rsi_driver_init() calls.
+ * @param[in]  buffer      -    Pointer to buffer from application. \n Driver uses this buffer to hold driver control for its operation.
+ * @param[in]  length      -    Length of the buffer.
+ * @param[in]  config      -    Driver configuration, NULL to keep the previous one (compile time defaults initially).
+ * @return     **Success** -    Returns the memory used, which is less than or equal to buffer length provided. \n
+ *             **Failure** -    Non-Zero values\n
+ *
+ *             			**RSI_ERROR_INVALID_PARAM**   -    If configuration is invalid or maximum sockets is greater than 10
+ */
+/** @} */
+
+int32_t rsi_driver_init_with_config(uint8_t *buffer, uint32_t length, const rsi_driver_config_t *config)
+{
+  uint8_t i;
 #if (defined RSI_WLAN_ENABLE) || (defined RSI_UART_INTERFACE) | (defined LINUX_PLATFORM)
   int32_t status = RSI_SUCCESS;
 #endif
 
   uint32_t actual_length = 0;
 
+  if (config != NULL) {
+    if (config->tx_arb_policy > RSI_TX_ARB_LATENCY_TARGET) {
+      return RSI_ERROR_INVALID_PARAM;
+    }
+    // Every pool in use needs at least one packet, WLAN data pool may be left out
+    for (i = RSI_PKT_POOL_WLAN_MGMT; i < RSI_PKT_POOL_MAX; i++) {
+      if (rsi_driver_pool_in_use(i) && (config->pool_pkt_count[i] == 0)) {
+        return RSI_ERROR_INVALID_PARAM;
+      }
+    }
+    // Lock free pool takes a single allocating and a single freeing context
+    for (i = 0; i < RSI_PKT_POOL_MAX; i++) {
+      if (config->pool_lock_free[i] && !(RSI_PKT_POOL_LOCK_FREE_CLASSES & BIT(i))) {
+        return RSI_ERROR_INVALID_PARAM;
+      }
+    }
+    memcpy(&rsi_driver_config, config, sizeof(rsi_driver_config_t));
+    rsi_driver_config_valid = 1;
+  } else if (!rsi_driver_config_valid) {
+    rsi_driver_config_init(&rsi_driver_config);
+    rsi_driver_config_valid = 1;
+  }
+
   // If (((uint32_t)buffer & 3) != 0)
   if (((uintptr_t)buffer & 3) != 0) // To avoid compiler warning, replace uint32_t with uintptr_t
   {
@@ -143,6 +310,10 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
   buffer += RSI_SOCKET_INFO_POOL_ROM_SIZE;
   rsi_socket_select_info = (rsi_socket_select_info_t *)buffer;
   buffer += RSI_SOCKET_SELECT_INFO_POOL_SIZE;
+  rsi_socket_epoll_info = (rsi_socket_epoll_info_t *)buffer;
+  buffer += RSI_SOCKET_EPOLL_INFO_POOL_SIZE;
+  rsi_socket_rx_ring = buffer;
+  buffer += RSI_SOCKET_RX_RING_POOL_SIZE;
   rsi_wlan_cb_non_rom = (rsi_wlan_cb_non_rom_t *)buffer;
   buffer += RSI_WLAN_CB_NON_ROM_POOL_SIZE;
 #ifdef PROCESS_SCAN_RESULTS_AT_HOST
@@ -151,7 +322,7 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
 #endif
 
   // Check for max no of sockets
-  if (RSI_NUMBER_OF_SOCKETS > (10 + RSI_NUMBER_OF_LTCP_SOCKETS)) {
+  if (RSI_NUMBER_OF_SOCKETS > (RSI_MODULE_MAX_SOCKETS + RSI_NUMBER_OF_LTCP_SOCKETS)) {
     status = RSI_ERROR_INVALID_PARAM;
     return status;
   }
@@ -167,13 +338,15 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
 
   // Designate memory for rx_pool
 #if !((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
-  rsi_pkt_pool_init(&rsi_driver_cb->rx_pool, buffer, RSI_DRIVER_RX_POOL_SIZE, RSI_DRIVER_RX_PKT_LEN);
-  buffer += RSI_DRIVER_RX_POOL_SIZE;
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_RX, &rsi_driver_cb->rx_pool, buffer);
 #endif
   // Designate memory for common_cb
   rsi_driver_cb_non_rom = (rsi_driver_cb_non_rom_t *)buffer;
   buffer += sizeof(rsi_driver_cb_non_rom_t);
 
+  // Initialize TX queue arbitration
+  rsi_tx_arb_init(&rsi_driver_cb_non_rom->tx_arb, &rsi_driver_config);
+
   // Designate memory for common_cb
   rsi_driver_cb->common_cb = (rsi_common_cb_t *)buffer;
   buffer += sizeof(rsi_common_cb_t);
@@ -182,8 +355,7 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
   rsi_common_cb_init(rsi_driver_cb->common_cb);
 
   // Designate pool for common block
-  rsi_pkt_pool_init(&rsi_driver_cb->common_cb->common_tx_pool, buffer, RSI_COMMON_POOL_SIZE, RSI_COMMON_CMD_LEN);
-  buffer += RSI_COMMON_POOL_SIZE;
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_COMMON, &rsi_driver_cb->common_cb->common_tx_pool, buffer);
 
   // Designate memory for wlan block
   rsi_driver_cb->wlan_cb = (rsi_wlan_cb_t *)buffer;
@@ -202,8 +374,11 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
 #endif
 
   // Designate memory for wlan_cb pool
-  rsi_pkt_pool_init(&rsi_driver_cb->wlan_cb->wlan_tx_pool, buffer, RSI_WLAN_POOL_SIZE, RSI_WLAN_CMD_LEN);
-  buffer += RSI_WLAN_POOL_SIZE;
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_WLAN_MGMT, &rsi_driver_cb->wlan_cb->wlan_tx_pool, buffer);
+#ifdef RSI_WLAN_ENABLE
+  // Designate memory for wlan data pool, if configured
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_WLAN_DATA, &rsi_wlan_cb_non_rom->wlan_data_tx_pool, buffer);
+#endif
 
   // Initialize scheduler
   rsi_scheduler_init(&rsi_driver_cb->scheduler_cb);
@@ -258,8 +433,7 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
   rsi_bt_cb_init(rsi_driver_cb->bt_common_cb, RSI_PROTO_BT_COMMON);
 
   // Designate memory for bt_common_cb pool
-  rsi_pkt_pool_init(&rsi_driver_cb->bt_common_cb->bt_tx_pool, buffer, RSI_BT_COMMON_POOL_SIZE, RSI_BT_COMMON_CMD_LEN);
-  buffer += ((RSI_BT_COMMON_POOL_SIZE + 3) & ~3);
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_BT_COMMON, &rsi_driver_cb->bt_common_cb->bt_tx_pool, buffer);
 
   rsi_queues_init(&rsi_driver_cb->bt_single_tx_q);
 #endif
@@ -273,11 +447,7 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
   rsi_bt_cb_init(rsi_driver_cb->bt_classic_cb, RSI_PROTO_BT_CLASSIC);
 
   // Designate memory for bt_classic_cb pool
-  rsi_pkt_pool_init(&rsi_driver_cb->bt_classic_cb->bt_tx_pool,
-                    buffer,
-                    RSI_BT_CLASSIC_POOL_SIZE,
-                    RSI_BT_CLASSIC_CMD_LEN);
-  buffer += ((RSI_BT_CLASSIC_POOL_SIZE + 3) & ~3);
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_BT_CLASSIC, &rsi_driver_cb->bt_classic_cb->bt_tx_pool, buffer);
 #endif
 
 #ifdef RSI_BLE_ENABLE
@@ -289,8 +459,7 @@ int32_t rsi_driver_init(uint8_t *buffer, uint32_t length)
   rsi_bt_cb_init(rsi_driver_cb->ble_cb, RSI_PROTO_BLE);
 
   // Designate memory for ble_cb pool
-  rsi_pkt_pool_init(&rsi_driver_cb->ble_cb->bt_tx_pool, buffer, RSI_BLE_POOL_SIZE, RSI_BLE_CMD_LEN);
-  buffer += ((RSI_BLE_POOL_SIZE + 3) & ~3);
+  buffer = rsi_driver_pkt_pool_init(RSI_PKT_POOL_BLE, &rsi_driver_cb->ble_cb->bt_tx_pool, buffer);
 #endif
 
 #ifdef RSI_PROP_PROTOCOL_ENABLE
@@ -1631,6 +1800,18 @@ int32_t rsi_driver_deinit(void)
   if (status != RSI_ERROR_NONE) {
     return RSI_ERROR_SEMAPHORE_DESTROY_FAILED;
   }
+#if (defined RSI_SPI_INTERFACE) && RSI_SPI_ASYNC_MIN_LEN
+  status = rsi_semaphore_destroy(&rsi_driver_cb_non_rom->spi_transfer_sem);
+  if (status != RSI_ERROR_NONE) {
+    return RSI_ERROR_SEMAPHORE_DESTROY_FAILED;
+  }
+#endif
+#if RSI_TX_GATHER_MIN_LEN
+  status = rsi_semaphore_destroy(&rsi_driver_cb_non_rom->tx_gather_sem);
+  if (status != RSI_ERROR_NONE) {
+    return RSI_ERROR_SEMAPHORE_DESTROY_FAILED;
+  }
+#endif
 #ifdef RSI_WLAN_ENABLE
   // Create WLAN semaphore
   status = rsi_semaphore_destroy(&rsi_driver_cb_non_rom->nwk_cmd_send_sem);
@@ -1657,6 +1838,12 @@ int32_t rsi_driver_deinit(void)
   if (status != RSI_ERROR_NONE) {
     return RSI_ERROR_SEMAPHORE_DESTROY_FAILED;
   }
+  if (rsi_wlan_cb_non_rom->wlan_data_tx_pool.size != 0) {
+    status = rsi_semaphore_destroy(&rsi_wlan_cb_non_rom->wlan_data_tx_pool.pkt_sem);
+    if (status != RSI_ERROR_NONE) {
+      return RSI_ERROR_SEMAPHORE_DESTROY_FAILED;
+    }
+  }
   rsi_mutex_destroy(&rsi_driver_cb->wlan_cb->wlan_mutex);
   rsi_socket_pool         = NULL;
   rsi_socket_pool_non_rom = NULL;
@@ -1916,14 +2103,118 @@ int32_t rsi_get_ram_log(uint32_t addr, uint32_t length)
  */
 
 int32_t rsi_driver_memory_estimate(void)
+{
+  return rsi_driver_memory_estimate_with_config(rsi_driver_config_valid ? &rsi_driver_config : NULL);
+}
+
+/*==============================================*/
+/**
+ *
+ * @brief      Provide the memory required by the driver for the given driver configuration. This is a non-blocking API.
+ * @param[in]  config - Driver configuration, NULL for compile time defaults
+ * @return     Driver pool size
+ *        	   
+ */
+
+int32_t rsi_driver_memory_estimate_with_config(const rsi_driver_config_t *config)
 {
   uint32_t actual_length = 0;
+  uint8_t i;
 
   // Calculate the Memory length of the application
   actual_length += RSI_DRIVER_POOL_SIZE;
+
+  if (config != NULL) {
+    // Replace compile time pool depths with configured ones
+    for (i = 0; i < RSI_PKT_POOL_MAX; i++) {
+      actual_length += rsi_driver_pool_size(i, config->pool_pkt_count[i]);
+      actual_length -= rsi_driver_pool_size(i, rsi_driver_default_pool_pkt_count[i]);
+    }
+  }
   return actual_length;
 }
 
+/*==============================================*/
+/**
+ * @brief       Get a driver packet pool, for example to match the pool reported to a watermark callback.
+ *              This is a non-blocking API.
+ * @param[in]   pool_class - Packet pool, one of rsi_pkt_pool_class_t
+ * @return      Pointer to packet pool, NULL if the pool is not used
+ */
+rsi_pkt_pool_t *rsi_driver_get_pkt_pool(uint8_t pool_class)
+{
+  if ((rsi_driver_cb == NULL) || (pool_class >= RSI_PKT_POOL_MAX) || !rsi_driver_pool_in_use(pool_class)) {
+    return NULL;
+  }
+  switch (pool_class) {
+#ifdef RSI_WLAN_ENABLE
+    case RSI_PKT_POOL_WLAN_DATA:
+      return rsi_wlan_get_data_tx_pool();
+#endif
+    case RSI_PKT_POOL_WLAN_MGMT:
+      return &rsi_driver_cb->wlan_cb->wlan_tx_pool;
+    case RSI_PKT_POOL_COMMON:
+      return &rsi_driver_cb->common_cb->common_tx_pool;
+#if (defined RSI_BT_ENABLE || defined RSI_BLE_ENABLE || defined RSI_PROP_PROTOCOL_ENABLE)
+    case RSI_PKT_POOL_BT_COMMON:
+      return &rsi_driver_cb->bt_common_cb->bt_tx_pool;
+#endif
+#ifdef RSI_BT_ENABLE
+    case RSI_PKT_POOL_BT_CLASSIC:
+      return &rsi_driver_cb->bt_classic_cb->bt_tx_pool;
+#endif
+#ifdef RSI_BLE_ENABLE
+    case RSI_PKT_POOL_BLE:
+      return &rsi_driver_cb->ble_cb->bt_tx_pool;
+#endif
+    default:
+      return &rsi_driver_cb->rx_pool;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Get TX arbitration statistics of a driver TX queue. This is a non-blocking API.
+ * @param[in]   queue          - TX queue, one of rsi_tx_arb_queue_t
+ * @param[out]  stats          - Frames/bytes served and head of line wait time of the queue
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure \n
+ */
+int32_t rsi_driver_get_tx_arb_stats(uint8_t queue, rsi_tx_arb_stats_t *stats)
+{
+  if ((queue >= RSI_TX_ARB_MAX_Q) || (stats == NULL)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  if ((rsi_driver_cb_non_rom == NULL) || (rsi_driver_cb_non_rom->device_state < RSI_DRIVER_INIT_DONE)) {
+    return RSI_ERROR_COMMAND_GIVEN_IN_WRONG_STATE;
+  }
+  memcpy(stats, &rsi_driver_cb_non_rom->tx_arb.stats[queue], sizeof(rsi_tx_arb_stats_t));
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @brief       Get SPI command protocol statistics. This is a non-blocking API.
+ * @param[out]  stats          - Commands sent in a single transfer, busy retries and start token polls
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure \n
+ */
+int32_t rsi_driver_get_spi_stats(rsi_spi_stats_t *stats)
+{
+  if (stats == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  if ((rsi_driver_cb_non_rom == NULL) || (rsi_driver_cb_non_rom->device_state < RSI_DRIVER_INIT_DONE)) {
+    return RSI_ERROR_COMMAND_GIVEN_IN_WRONG_STATE;
+  }
+#ifdef RSI_SPI_INTERFACE
+  memcpy(stats, &rsi_driver_cb_non_rom->spi_stats, sizeof(rsi_spi_stats_t));
+#else
+  memset(stats, 0, sizeof(rsi_spi_stats_t));
+#endif
+  return RSI_SUCCESS;
+}
+
 /*==============================================*/
 /**
  *
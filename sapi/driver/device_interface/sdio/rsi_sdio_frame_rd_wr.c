@@ -94,5 +94,34 @@ int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloadparam,
     return RSI_ERROR_SDIO_WRITE_FAIL;
   }
 }
+
+/*====================================================*/
+/**
+ * @brief       Write a frame whose payload is scattered over multiple buffers. SDIO moves the frame in
+ *              blocks from a single buffer, so segments are gathered right after the frame descriptor,
+ *              which must have room for the whole frame.
+ * @param[in]   uFrameDscFrame  -  Frame descriptor
+ * @param[in]   iov             -  Payload segments
+ * @param[in]   iovcnt          -  Number of payload segments
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ *
+ */
+int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt)
+{
+  uint8_t *payload    = ((uint8_t *)uFrameDscFrame + RSI_FRAME_DESC_LEN);
+  uint16_t size_param = 0;
+  uint8_t i;
+
+  for (i = 0; i < iovcnt; i++) {
+    // Segments already in place are not moved
+    if (iov[i].buffer != (payload + size_param)) {
+      memmove(payload + size_param, iov[i].buffer, iov[i].length);
+    }
+    size_param += iov[i].length;
+  }
+
+  return rsi_frame_write(uFrameDscFrame, payload, size_param);
+}
 #endif
 /** @} */
@@ -39,22 +39,63 @@
 */
 /*===========================================================================*/
 /**
+ * @brief       Hold the module memory window between memory accesses.
+ *              While held, window registers are written only when the upper half of the address changes.
+ * @param[in]   hold - 1 to hold the window, 0 to write it on every access again
+ * @return      void
  */
+void rsi_sdio_mem_window_hold(uint8_t hold)
+{
+  rsi_driver_cb_non_rom->sdio_mem_window_valid = 0;
+  rsi_driver_cb_non_rom->sdio_mem_window_hold  = hold;
+}
 
-int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf)
+/*===========================================================================*/
+/**
+ * @brief       Set the module memory window, upper half of the address, for a memory access.
+ * @param[in]   addr - Address of the memory access
+ * @return      0 - SUCCESS \n
+ *              Non-Zero Value - Failure
+ */
+static int16_t rsi_sdio_set_mem_window(uint32_t addr)
 {
   uint8_t data;
+  int16_t retval  = RSI_SUCCESS;
+  uint16_t window = (uint16_t)(addr >> 16);
+  uint8_t valid   = rsi_driver_cb_non_rom->sdio_mem_window_valid;
+
+  rsi_driver_cb_non_rom->sdio_mem_window_valid = 0;
+  if (!valid || ((window >> 8) != (rsi_driver_cb_non_rom->sdio_mem_window >> 8))) {
+    data = ((addr & 0xff000000) >> 24);
+    // write MSB to 0xFB
+    retval = rsi_reg_wr(0xfb, &data);
+    if (retval != RSI_SUCCESS)
+      return retval;
+  }
+  if (!valid || ((window & 0xff) != (rsi_driver_cb_non_rom->sdio_mem_window & 0xff))) {
+    data = ((addr & 0x00ff0000) >> 16);
+    // write MSB to 0xFA
+    retval = rsi_reg_wr(0xfa, &data);
+    if (retval != RSI_SUCCESS)
+      return retval;
+  }
+  if (rsi_driver_cb_non_rom->sdio_mem_window_hold) {
+    rsi_driver_cb_non_rom->sdio_mem_window       = window;
+    rsi_driver_cb_non_rom->sdio_mem_window_valid = 1;
+  }
+  return retval;
+}
+
+/*===========================================================================*/
+/**
+ */
+
+int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf)
+{
   int16_t retval        = RSI_SUCCESS;
   uint16_t no_of_blocks = 0;
-  data                  = ((addr & 0xff000000) >> 24);
-  // write MSB to 0xFB
-  retval = rsi_reg_wr(0xfb, &data);
-  if (retval != RSI_SUCCESS)
-    return retval;
 
-  data = ((addr & 0x00ff0000) >> 16);
-  // write MSB to 0xFA
-  retval = rsi_reg_wr(0xfa, &data);
+  retval = rsi_sdio_set_mem_window(addr);
   if (retval != RSI_SUCCESS)
     return retval;
 
@@ -77,17 +118,8 @@ int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf)
 int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf)
 {
   int16_t retval = RSI_SUCCESS;
-  uint8_t data;
-
-  data = ((addr & 0xff000000) >> 24);
-  // write MSB to 0xFB
-  retval = rsi_reg_wr(0xfb, &data);
-  if (retval != RSI_SUCCESS)
-    return retval;
 
-  data = ((addr & 0x00ff0000) >> 16);
-  // write MSB to 0xFA
-  retval = rsi_reg_wr(0xfa, &data);
+  retval = rsi_sdio_set_mem_window(addr);
   if (retval != RSI_SUCCESS)
     return retval;
 
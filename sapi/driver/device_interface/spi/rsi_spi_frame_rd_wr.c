@@ -89,16 +89,13 @@ int16_t rsi_nlink_pkt_rd(uint8_t *buf, uint16_t total_len)
   // Upper byte of transfer length
   c4 = (aligned_len & 0xff00) >> 8;
 
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != 0) {
     // Exit with error if timed out waiting for the SPI to get ready
     return retval;
   }
 
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
-
   // Wait for start token
   retval = rsi_spi_wait_start_token(RSI_START_TOKEN_TIMEOUT, RSI_MODE_32BIT);
   if (retval != 0) {
@@ -106,7 +103,7 @@ int16_t rsi_nlink_pkt_rd(uint8_t *buf, uint16_t total_len)
     return retval;
   }
 
-  retval = rsi_spi_transfer(NULL, spi_read_pkt, aligned_len, RSI_MODE_8BIT);
+  retval = rsi_spi_bulk_transfer(NULL, spi_read_pkt, aligned_len, RSI_MODE_8BIT);
   if (retval != 0) {
     // Exit with error if timed out waiting for the SPI to get ready
     return retval;
@@ -144,8 +141,16 @@ int16_t rsi_frame_read(uint8_t *pkt_buffer)
 {
 
   int16_t retval;
+#if (defined RSI_CHIP_MFG_EN) || !RSI_SPI_RX_PREFIX_LEN
   uint8_t local_buffer[8];
-#ifndef RSI_CHIP_MFG_EN
+#endif
+#if (!defined RSI_CHIP_MFG_EN) && RSI_SPI_RX_PREFIX_LEN
+  // Read pre-descriptor and start of frame at once
+  retval = rsi_spi_frame_prefix_rd(pkt_buffer);
+  if (retval != RSI_SUCCESS) {
+    return retval;
+  }
+#elif !defined RSI_CHIP_MFG_EN
   // Read first 4 bytes
   retval = rsi_pre_dsc_rd(&local_buffer[0]);
   if (retval != RSI_SUCCESS) {
@@ -248,6 +253,47 @@ int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloadparam,
   return retval;
 }
 
+/*====================================================*/
+/**
+ * @brief       Write a frame whose payload is scattered over multiple buffers. Payload segments are
+ *              sent back to back in a single data write, so they need not be coalesced into one buffer.
+ * @param[in]   uFrameDscFrame  -  Frame descriptor
+ * @param[in]   iov             -  Payload segments
+ * @param[in]   iovcnt          -  Number of payload segments
+ * @return       0              - SUCCESS \n
+ *             < 0              - FAILURE \n
+ *              -1              - SPI busy / Timeout in case of SPI \n
+ *              -2              - SPI Failure in case of SPI
+ *
+ */
+int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt)
+{
+  int16_t retval      = RSI_SUCCESS;
+  uint16_t size_param = 0;
+  uint8_t i;
+
+  for (i = 0; i < iovcnt; i++) {
+    size_param += iov[i].length;
+  }
+
+#ifdef RSI_CHIP_MFG_EN
+  // Host descriptor is sent as part of the data write
+  retval = rsi_spi_frame_data_writev((uint8_t *)uFrameDscFrame, RSI_HOST_DESC_LENGTH, iov, iovcnt);
+#else
+  // Write host descriptor
+  retval = rsi_spi_frame_dsc_wr(uFrameDscFrame);
+  if (retval != RSI_SUCCESS) {
+    return retval;
+  }
+
+  // Write payload if present
+  if (size_param) {
+    retval = rsi_spi_frame_data_writev(NULL, 0, iov, iovcnt);
+  }
+#endif
+  return retval;
+}
+
 /*===========================================================================*/
 /**
  * @brief       Perform a pre-frame decriptor read.
@@ -264,6 +310,8 @@ int16_t rsi_pre_dsc_rd(uint8_t *dbuf)
   uint8_t c2;
   uint8_t c3;
   uint8_t c4;
+  uint8_t prefetch[4];
+  uint8_t prefetch_len;
 
   c1 = RSI_C1FRMRD16BIT4BYTE;
 #ifdef RSI_BIT_32_SUPPORT
@@ -277,28 +325,21 @@ int16_t rsi_pre_dsc_rd(uint8_t *dbuf)
   // Upper byte of transfer length
   c4 = 0x00;
 
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
-  if (retval != RSI_SUCCESS) {
-    // Exit with error if timed out waiting for the SPI to get ready
-    return retval;
-  }
-
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
 
   // Wait for start token
-  retval = rsi_spi_wait_start_token(RSI_START_TOKEN_TIMEOUT, RSI_MODE_32BIT);
+  retval = rsi_spi_wait_start_token_prefetch(RSI_START_TOKEN_TIMEOUT, RSI_MODE_32BIT, 0x4, prefetch, &prefetch_len);
   if (retval != RSI_SUCCESS) {
     // Exit with error if timed out waiting for the SPI to get ready
     return retval;
   }
 
   // SPI read after start token
-  retval = rsi_spi_transfer(NULL, (uint8_t *)dbuf, 0x4, RSI_MODE_32BIT);
+  retval = rsi_spi_read_prefetched((uint8_t *)dbuf, 0x4, RSI_MODE_32BIT, prefetch, &prefetch_len);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
@@ -331,6 +372,8 @@ int16_t rsi_pkt_rd(uint8_t *buf, uint16_t dummy_len, uint16_t total_len)
   uint8_t dummy_buf[8];
 #endif
   uint32_t aligned_len = 0;
+  uint8_t prefetch[4];
+  uint8_t prefetch_len;
 
   aligned_len = ((total_len) + 3) & ~3;
 
@@ -346,28 +389,25 @@ int16_t rsi_pkt_rd(uint8_t *buf, uint16_t dummy_len, uint16_t total_len)
   // Upper byte of transfer length
   c4 = (aligned_len & 0xff00) >> 8;
 
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
-  if (retval != RSI_SUCCESS) {
-    // Exit with error if timed out waiting for the SPI to get ready
-    return retval;
-  }
-
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
 
-  // Wait for start token
-  retval = rsi_spi_wait_start_token(RSI_START_TOKEN_TIMEOUT, RSI_MODE_32BIT);
+  // Wait for start token, data is prefetched only if it is all read
+  retval = rsi_spi_wait_start_token_prefetch(RSI_START_TOKEN_TIMEOUT,
+                                             RSI_MODE_32BIT,
+                                             (buf ? aligned_len : dummy_len),
+                                             prefetch,
+                                             &prefetch_len);
   if (retval != RSI_SUCCESS) {
     // Exit with error if timed out waiting for the SPI to get ready
     return retval;
   }
 
   if (dummy_len) {
-    retval = rsi_spi_transfer(NULL, (uint8_t *)&dummy_buf[0], dummy_len, RSI_MODE_8BIT);
+    retval = rsi_spi_read_prefetched((uint8_t *)&dummy_buf[0], dummy_len, RSI_MODE_8BIT, prefetch, &prefetch_len);
     if (retval != RSI_SUCCESS) {
       return retval;
     }
@@ -375,7 +415,7 @@ int16_t rsi_pkt_rd(uint8_t *buf, uint16_t dummy_len, uint16_t total_len)
 
   // Actual spi read for descriptor and payload
   if (buf) {
-    retval = rsi_spi_transfer(NULL, buf, (aligned_len - dummy_len), RSI_MODE_32BIT);
+    retval = rsi_spi_read_prefetched(buf, (aligned_len - dummy_len), RSI_MODE_32BIT, prefetch, &prefetch_len);
     if (retval != RSI_SUCCESS) {
       return retval;
     }
@@ -384,6 +424,93 @@ int16_t rsi_pkt_rd(uint8_t *buf, uint16_t dummy_len, uint16_t total_len)
   return retval;
 }
 
+#if RSI_SPI_RX_PREFIX_LEN
+// Pre-descriptor and start of frame read along with it
+static uint8_t spi_rx_prefix[4 + RSI_SPI_RX_PREFIX_LEN];
+
+/*===========================================================================*/
+/**
+ * @brief       Read a frame in a single transaction, pre-decriptor along with the first RSI_SPI_RX_PREFIX_LEN bytes
+ *              of frame. Rest of frames longer than that is read by a second transaction.
+ * @param[in]   pkt_buffer - Pointer to the buffer into which decriptor and payload has to be read
+ * @return      0 - SUCCESS \n
+ *              -1 - SPI busy / Timeout \n
+ *              -2 - SPI Failure
+ *
+ */
+int16_t rsi_spi_frame_prefix_rd(uint8_t *pkt_buffer)
+{
+  int16_t retval;
+  uint8_t c1;
+  uint8_t c2;
+  uint8_t c3;
+  uint8_t c4;
+  uint8_t prefetch[4];
+  uint8_t prefetch_len;
+  uint16_t aligned_len;
+  uint16_t dummy_len;
+  uint16_t read_len;
+  uint16_t copy_len = 0;
+
+  c1 = RSI_C1FRMRD16BIT4BYTE;
+#ifdef RSI_BIT_32_SUPPORT
+  c2 = RSI_C2SPIADDR4BYTE;
+#else
+  c2 = RSI_C2MEMRDWRNOCARE;
+#endif
+  // Lower byte of transfer length
+  c3 = (uint8_t)(sizeof(spi_rx_prefix) & 0x00ff);
+
+  // Upper byte of transfer length
+  c4 = (uint8_t)((sizeof(spi_rx_prefix) >> 8) & 0x00ff);
+
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
+  if (retval != RSI_SUCCESS) {
+    // Exit with error if timed out waiting for the SPI to get ready
+    return retval;
+  }
+
+  // Wait for start token
+  retval = rsi_spi_wait_start_token_prefetch(RSI_START_TOKEN_TIMEOUT,
+                                             RSI_MODE_32BIT,
+                                             sizeof(spi_rx_prefix),
+                                             prefetch,
+                                             &prefetch_len);
+  if (retval != RSI_SUCCESS) {
+    // Exit with error if timed out waiting for the SPI to get ready
+    return retval;
+  }
+
+  // SPI read after start token
+  retval = rsi_spi_read_prefetched(spi_rx_prefix, sizeof(spi_rx_prefix), RSI_MODE_32BIT, prefetch, &prefetch_len);
+  if (retval != RSI_SUCCESS) {
+    return retval;
+  }
+
+  // Frame bytes following the pre-descriptor, leading dummy bytes of them are discarded
+  aligned_len = ((rsi_bytes2R_to_uint16(&spi_rx_prefix[0]) - 4) + 3) & ~3;
+  dummy_len   = rsi_bytes2R_to_uint16(&spi_rx_prefix[2]) - 4;
+
+  // Take the part of frame read already
+  read_len = (aligned_len < RSI_SPI_RX_PREFIX_LEN) ? aligned_len : RSI_SPI_RX_PREFIX_LEN;
+  if (read_len > dummy_len) {
+    copy_len = read_len - dummy_len;
+    memcpy(pkt_buffer, &spi_rx_prefix[4 + dummy_len], copy_len);
+    dummy_len = 0;
+  } else {
+    dummy_len -= read_len;
+  }
+
+  // Read the rest of longer frame
+  if (aligned_len > RSI_SPI_RX_PREFIX_LEN) {
+    retval = rsi_pkt_rd(&pkt_buffer[copy_len], dummy_len, (aligned_len - RSI_SPI_RX_PREFIX_LEN));
+  }
+
+  return retval;
+}
+#endif
+
 /*===========================================================================*/
 /**
  * @brief       Write a Frame descriptor.
@@ -414,15 +541,8 @@ int16_t rsi_spi_frame_dsc_wr(rsi_frame_desc_t *uFrameDscFrame)
   // Upper byte of transfer length
   c4 = 0x00;
 
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
-  if (retval != RSI_SUCCESS) {
-    // Exit with error if timed out waiting for the SPI to get ready
-    return retval;
-  }
-
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
     // Exit with error if timed out waiting for the SPI to get ready
     return retval;
@@ -471,31 +591,101 @@ int16_t rsi_spi_frame_data_wr(uint16_t bufLen, uint8_t *dBuf, uint16_t tbufLen,
   // Upper byte of transfer length
   c4 = (uint8_t)((tempbufLen >> 8) & 0x00FF);
 
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
-    // Exit with error if timed out waiting for the SPI to get ready
     return retval;
   }
 
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
+  // SPI send
+  retval = rsi_spi_bulk_transfer(dBuf, NULL, bufLen, RSI_MODE_32BIT);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
+  if (tbufLen) {
+    retval = rsi_spi_bulk_transfer(tBuf, NULL, tbufLen, RSI_MODE_32BIT);
+    if (retval != RSI_SUCCESS) {
+      return retval;
+    }
+  }
 
-  // SPI send
-  retval = rsi_spi_transfer(dBuf, NULL, bufLen, RSI_MODE_32BIT);
+  return retval;
+}
+
+/*===========================================================================*/
+/**
+ * @brief       Perform Frame Data Write from multiple buffers in a single transfer.
+ *              Transfer length is 4 byte aligned, padding is sent after the last segment.
+ * @param[in]   hBuf         -   Pointer to the buffer written before the segments, NULL if none
+ * @param[in]   hbufLen      -   Length of hBuf
+ * @param[in]   iov          -   Data segments to write
+ * @param[in]   iovcnt       -   Number of data segments
+ * @return      0 - SUCCESS \n
+ *              -1 - SPI busy / Timeout \n
+ *              -2 - SPI Failure
+ *
+ */
+int16_t rsi_spi_frame_data_writev(uint8_t *hBuf, uint16_t hbufLen, const rsi_frame_iovec_t *iov, uint8_t iovcnt)
+{
+  static uint8_t pad[4];
+  int16_t retval;
+  uint8_t c1;
+  uint8_t c2;
+  uint8_t c3;
+  uint8_t c4;
+  uint8_t i;
+  uint16_t tempbufLen;
+  uint16_t alignedLen;
+
+  tempbufLen = hbufLen;
+  for (i = 0; i < iovcnt; i++) {
+    tempbufLen += iov[i].length;
+  }
+
+  // 4 byte align for transfer length
+  alignedLen = (tempbufLen + 3) & ~3;
+
+  c1 = RSI_C1FRMWR16BIT4BYTE;
+#ifdef RSI_BIT_32_SUPPORT
+  c2 = RSI_C2RDWR4BYTE;
+#else
+  c2 = RSI_C2RDWR1BYTE;
+#endif
+  // Lower byte of transfer length
+  c3 = (uint8_t)(alignedLen & 0x00ff);
+
+  // Upper byte of transfer length
+  c4 = (uint8_t)((alignedLen >> 8) & 0x00FF);
+
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
-  if (tbufLen) {
-    retval = rsi_spi_transfer(tBuf, NULL, tbufLen, RSI_MODE_32BIT);
+
+  if (hbufLen) {
+    retval = rsi_spi_transfer(hBuf, NULL, hbufLen, RSI_MODE_32BIT);
     if (retval != RSI_SUCCESS) {
       return retval;
     }
   }
 
+  // SPI send, segments not multiple of 4 bytes are sent in 8 bit mode
+  for (i = 0; i < iovcnt; i++) {
+    if (iov[i].length == 0) {
+      continue;
+    }
+    retval =
+      rsi_spi_bulk_transfer(iov[i].buffer, NULL, iov[i].length, (iov[i].length & 3) ? RSI_MODE_8BIT : RSI_MODE_32BIT);
+    if (retval != RSI_SUCCESS) {
+      return retval;
+    }
+  }
+
+  if (alignedLen != tempbufLen) {
+    retval = rsi_spi_transfer(pad, NULL, (alignedLen - tempbufLen), RSI_MODE_8BIT);
+  }
+
   return retval;
 }
 
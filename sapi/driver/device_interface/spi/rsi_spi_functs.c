@@ -63,6 +63,9 @@ int16_t rsi_send_c1c2(uint8_t c1, uint8_t c2)
   // Reset the timeout timer to 0
   RSI_RESET_TIMER1;
 
+  // Module answering at once is taken as ready for following commands
+  rsi_driver_cb_non_rom->spi_ready = 1;
+
   while (1) {
     txCmd[0] = c1;
     txCmd[1] = c2;
@@ -83,8 +86,13 @@ int16_t rsi_send_c1c2(uint8_t c1, uint8_t c2)
     } else if (localBuf[1] == RSI_SPI_BUSY) {
       // Busy, retry once again
       retval = RSI_ERROR_SPI_BUSY;
+      rsi_driver_cb_non_rom->spi_stats.busy_retries++;
+      rsi_driver_cb_non_rom->spi_ready = 0;
     }
   }
+  if (retval != RSI_SUCCESS) {
+    rsi_driver_cb_non_rom->spi_ready = 0;
+  }
 
   return retval;
 }
@@ -117,6 +125,60 @@ int16_t rsi_send_c3c4(uint8_t c3, uint8_t c4)
   return retval;
 }
 
+/*==================================================*/
+/**
+ * @brief       Send the C1 to C4 command bytes. While module answered the previous command at once, they are sent
+ *              in a single transfer, otherwise using rsi_send_c1c2() and rsi_send_c3c4().
+ * @param[in]   c1 - SPI c1 command
+ * @param[in]   c2 - SPI c2 command
+ * @param[in]   c3 - SPI c3 command
+ * @param[in]   c4 - SPI c4 command
+ * @return      0 - SUCCESS \n
+ *              -1 - SPI busy / Timeout \n
+ *              -2 - SPI Failure
+ */
+int16_t rsi_send_c1c2c3c4(uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4)
+{
+  int16_t retval;
+#if RSI_SPI_MERGED_CMD
+  uint8_t txCmd[4];
+  uint8_t localBuf[4];
+
+  if (rsi_driver_cb_non_rom->spi_ready) {
+    txCmd[0] = c1;
+    txCmd[1] = c2;
+    txCmd[2] = c3;
+    txCmd[3] = c4;
+
+    // Send C1 to C4, answer to C1 is received with C2
+    retval = rsi_spi_transfer(txCmd, localBuf, 4, RSI_MODE_8BIT);
+    if (retval != RSI_SUCCESS) {
+      return retval;
+    }
+    if ((localBuf[1] == RSI_SPI_SUCCESS) || (localBuf[1] == 0x00)) {
+      rsi_driver_cb_non_rom->spi_stats.merged_cmds++;
+      return RSI_SUCCESS;
+    }
+    rsi_driver_cb_non_rom->spi_ready = 0;
+    if (localBuf[1] == RSI_SPI_FAIL) {
+      return RSI_ERROR_SPI_FAIL;
+    }
+    // Module is busy, C3/C4 following right after are refused as well, so the command is sent again in steps
+    rsi_driver_cb_non_rom->spi_stats.busy_retries++;
+  }
+#endif
+
+  // Send C1/C2
+  retval = rsi_send_c1c2(c1, c2);
+  if (retval != RSI_SUCCESS) {
+    // Exit with error if timed out waiting for the SPI to get ready
+    return retval;
+  }
+
+  // Send C3/C4
+  return rsi_send_c3c4(c3, c4);
+}
+
 /*==================================================*/
 /**
  * @brief         Loop reading the SPI until a start token, 0x55, is received.
@@ -151,6 +213,7 @@ int16_t rsi_spi_wait_start_token(uint32_t timeout, uint8_t mode)
     }
 
     txChar = 0x00;
+    rsi_driver_cb_non_rom->spi_stats.token_polls++;
 #ifdef RSI_BIT_32_SUPPORT
     if (mode == RSI_MODE_8BIT)
 #endif
@@ -168,6 +231,149 @@ int16_t rsi_spi_wait_start_token(uint32_t timeout, uint8_t mode)
   return retval;
 }
 
+/*==================================================*/
+/**
+ * @brief         Loop reading the SPI until a start token, 0x55, is received. For reads of 3 bytes or more, the SPI is
+ *                read 4 bytes at a time, bytes received after the start token are the first bytes of data read.
+ * @pre           Should issue read commands before using this function
+ * @param[in]     timeout      - Timeout for start token.
+ * @param[in]     mode         - To indicate 8-bit/32-bit mode.
+ * @param[in]     read_len     - Number of bytes to be read after start token
+ * @param[out]    prefetch     - Buffer of 4 bytes to hold data received after start token
+ * @param[out]    prefetch_len - Number of bytes in prefetch
+ * @return        0 - SUCCESS \n
+ *               -1 - SPI busy / Timeout \n
+ *               -2 - SPI Failure
+ */
+int16_t rsi_spi_wait_start_token_prefetch(uint32_t timeout,
+                                          uint8_t mode,
+                                          uint16_t read_len,
+                                          uint8_t *prefetch,
+                                          uint8_t *prefetch_len)
+{
+#ifndef RSI_BIT_32_SUPPORT
+  int16_t retval;
+  uint8_t rxWord[4];
+  uint8_t i;
+#endif
+
+  *prefetch_len = 0;
+#ifndef RSI_BIT_32_SUPPORT
+  // Shorter reads are polled byte by byte, not to clock bytes beyond the end of data
+  if (read_len >= 3) {
+    // Reset the timeout timer to 0;
+    RSI_RESET_TIMER1;
+
+    while (1) {
+      if (RSI_INC_TIMER_1 > timeout) {
+        // Timeout
+        return RSI_ERROR_SPI_BUSY;
+      }
+      rsi_driver_cb_non_rom->spi_stats.token_polls++;
+      retval = rsi_spi_transfer(NULL, rxWord, 4, RSI_MODE_8BIT);
+      if (retval != RSI_SUCCESS) {
+        return retval;
+      }
+      for (i = 0; i < 4; i++) {
+        if (rxWord[i] == RSI_SPI_START_TOKEN) {
+          // Found the start token, keep the data following it
+          *prefetch_len = 3 - i;
+          memcpy(prefetch, &rxWord[i + 1], *prefetch_len);
+          return RSI_SUCCESS;
+        }
+      }
+    }
+  }
+#else
+  UNUSED_PARAMETER(read_len); //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(prefetch); //This statement is added only to resolve compilation warning, value is unchanged
+#endif
+  return rsi_spi_wait_start_token(timeout, mode);
+}
+
+/*==================================================*/
+/**
+ * @brief         Read data after start token, taking bytes received with the start token first.
+ * @pre           rsi_spi_wait_start_token_prefetch() should be called before using this function
+ * @param[out]    buf          - Pointer to the buffer to read data into
+ * @param[in]     len          - Number of bytes to read
+ * @param[in]     mode         - To indicate 8-bit/32-bit mode.
+ * @param[in,out] prefetch     - Data received after start token, bytes taken are removed
+ * @param[in,out] prefetch_len - Number of bytes in prefetch
+ * @return        0 - SUCCESS \n
+ *               -1 - SPI busy / Timeout \n
+ *               -2 - SPI Failure
+ */
+int16_t rsi_spi_read_prefetched(uint8_t *buf, uint16_t len, uint8_t mode, uint8_t *prefetch, uint8_t *prefetch_len)
+{
+  uint8_t taken = *prefetch_len;
+
+  if (taken > len) {
+    taken = (uint8_t)len;
+  }
+  if (taken) {
+    memcpy(buf, prefetch, taken);
+    *prefetch_len -= taken;
+    memmove(prefetch, &prefetch[taken], *prefetch_len);
+    buf += taken;
+    len -= taken;
+    // Rest is not word aligned any more
+    mode = RSI_MODE_8BIT;
+  }
+  if (len == 0) {
+    return RSI_SUCCESS;
+  }
+  return rsi_spi_bulk_transfer(NULL, buf, len, mode);
+}
+
+#if RSI_SPI_ASYNC_MIN_LEN
+/*==================================================*/
+/**
+ * @brief       Completion handler of asynchronous SPI transfer, called by HAL from interrupt context.
+ * @param[in]   void
+ * @return      void
+ */
+static void rsi_spi_transfer_done(void)
+{
+  rsi_semaphore_post_from_isr(&rsi_driver_cb_non_rom->spi_transfer_sem);
+}
+#endif
+
+/*==================================================*/
+/**
+ * @brief       Transfer frame data to/from the module. Transfers of RSI_SPI_ASYNC_MIN_LEN bytes or more
+ *              are started using rsi_spi_transfer_async() and the calling task blocks till HAL reports
+ *              completion, shorter ones are made using rsi_spi_transfer(). A transfer not completed in time is
+ *              aborted, so that it can not complete into the next one.
+ * @param[in]   tx_buff         - Pointer to the buffer with the data to be transferred, NULL to send dummy bytes
+ * @param[in]   rx_buff         - Pointer to the buffer to store the data received, NULL to discard it
+ * @param[in]   transfer_length - Number of bytes to send and receive
+ * @param[in]   mode            - To indicate 8-bit/32-bit mode.
+ * @return      0 - SUCCESS \n
+ *              -1 - SPI busy / Timeout \n
+ *              -2 - SPI Failure
+ */
+int16_t rsi_spi_bulk_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode)
+{
+#if RSI_SPI_ASYNC_MIN_LEN
+  // Device init may run before the OS scheduler is started, when the caller can not block
+  if ((transfer_length >= RSI_SPI_ASYNC_MIN_LEN) && (rsi_driver_cb_non_rom->device_state == RSI_DEVICE_INIT_DONE)) {
+    // HAL not able to start the transfer asynchronously makes it synchronously
+    if (rsi_spi_transfer_async(tx_buff, rx_buff, transfer_length, mode, rsi_spi_transfer_done) == RSI_SUCCESS) {
+      if (rsi_semaphore_wait(&rsi_driver_cb_non_rom->spi_transfer_sem, RSI_SPI_ASYNC_TIMEOUT) != RSI_ERROR_NONE) {
+        // Stop DMA and drop completion handler, nothing is posted once this returns
+        rsi_spi_transfer_abort();
+        // Take completion posted before the abort, if any, so that next transfer does not see it
+        rsi_semaphore_wait(&rsi_driver_cb_non_rom->spi_transfer_sem, RSI_SPI_ASYNC_DRAIN_TIMEOUT);
+        return RSI_ERROR_SPI_BUSY;
+      }
+      return RSI_SUCCESS;
+    }
+  }
+#endif
+  return rsi_spi_transfer(tx_buff, rx_buff, transfer_length, mode);
+}
+
 /*==================================================*/
 /**
  * @brief       Set the INTERRUPT MASK REGISTER of the module.
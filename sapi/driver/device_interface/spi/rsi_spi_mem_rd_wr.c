@@ -55,7 +55,7 @@
  */
 int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf)
 {
-  uint8_t txCmd[4];
+  uint8_t txCmd[4 + RSI_SPI_MEM_WR_INLINE_LEN];
   int16_t retval;
   uint8_t c1;
   uint8_t c2;
@@ -76,22 +76,22 @@ int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf)
 
   rsi_uint32_to_4bytes(txCmd, addr);
 
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
-
-  // Check for SPI Busy/Error
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
 
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
-  if (retval != RSI_SUCCESS) {
-    return retval;
+#ifndef RSI_BIT_32_SUPPORT
+  // Send short data, register writes, along with the address
+  if (len <= RSI_SPI_MEM_WR_INLINE_LEN) {
+    memcpy(&txCmd[4], dBuf, len);
+    return rsi_spi_transfer(txCmd, NULL, 4 + len, RSI_MODE_8BIT);
   }
+#endif
 
   // Send the 4 address bytes
-  retval = rsi_spi_transfer(txCmd, NULL, sizeof(txCmd), RSI_MODE_8BIT);
+  retval = rsi_spi_transfer(txCmd, NULL, 4, RSI_MODE_8BIT);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
@@ -132,6 +132,8 @@ int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf)
   uint8_t c3;
   uint8_t c4;
   uint8_t localBuf[8];
+  uint8_t prefetch[4];
+  uint8_t prefetch_len;
 
   c1 = RSI_C1MEMRD16BIT4BYTE;
 #ifdef RSI_BIT_32_SUPPORT
@@ -146,16 +148,8 @@ int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf)
   txCmd[1] = (addr >> 8) & 0x000000ff;  // A1, Byte 1 of address
   txCmd[2] = (addr >> 16) & 0x000000ff; // A2, Byte 2 of address
   txCmd[3] = (addr >> 24) & 0x000000ff; // A3, Byte 3 of address (MSB)
-  // Send C1/C2
-  retval = rsi_send_c1c2(c1, c2);
-
-  // Check for SPI busy
-  if (retval != RSI_SUCCESS) {
-    return retval;
-  }
-
-  // Send C3/C4
-  retval = rsi_send_c3c4(c3, c4);
+  // Send C1 to C4
+  retval = rsi_send_c1c2c3c4(c1, c2, c3, c4);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
@@ -165,12 +159,12 @@ int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf)
     return retval;
   }
   // Wait for the start token
-  retval = rsi_spi_wait_start_token(RSI_START_TOKEN_TIMEOUT, RSI_MODE_8BIT);
+  retval = rsi_spi_wait_start_token_prefetch(RSI_START_TOKEN_TIMEOUT, RSI_MODE_8BIT, len, prefetch, &prefetch_len);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
   // Read in the memory data
-  retval = rsi_spi_transfer(NULL, dBuf, len, RSI_MODE_8BIT);
+  retval = rsi_spi_read_prefetched(dBuf, len, RSI_MODE_8BIT, prefetch, &prefetch_len);
   if (retval != RSI_SUCCESS) {
     return retval;
   }
@@ -77,6 +77,41 @@ int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloadparam,
   return retval;
 }
 
+/*==============================================*/
+/**
+ * @brief       Write a frame whose payload is scattered over multiple buffers. Descriptor and
+ *              segments are sent back to back on the byte stream.
+ * @param[in]   uFrameDscFrame - Frame descriptor
+ * @param[in]   iov            - Payload segments
+ * @param[in]   iovcnt         - Number of payload segments
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ */
+int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt)
+{
+  int16_t retval;
+  uint8_t i;
+
+  // API to write frame descriptor to UART interface
+  retval = rsi_uart_send((uint8_t *)uFrameDscFrame, RSI_FRAME_DESC_LEN);
+
+  for (i = 0; (i < iovcnt) && (retval == 0); i++) {
+    // Previous segment must be out before next one is given to UART
+    while (huart1.gState != HAL_UART_STATE_READY)
+      ;
+    while (huart1.TxXferCount != 0)
+      ;
+    if (iov[i].length) {
+      retval = rsi_uart_send(iov[i].buffer, iov[i].length);
+    }
+  }
+  while (huart1.gState != HAL_UART_STATE_READY)
+    ;
+  while (huart1.TxXferCount != 0)
+    ;
+  return retval;
+}
+
 /*==============================================*/
 /**
  * @brief       Initialize the UART interface module.
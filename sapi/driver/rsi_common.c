@@ -92,6 +92,18 @@ int8_t rsi_common_cb_init(rsi_common_cb_t *common_cb)
   if (retval != RSI_ERROR_NONE) {
     return RSI_ERROR_SEMAPHORE_CREATE_FAILED;
   }
+#endif
+#if (defined RSI_SPI_INTERFACE) && RSI_SPI_ASYNC_MIN_LEN
+  retval = rsi_semaphore_create(&rsi_driver_cb_non_rom->spi_transfer_sem, 0);
+  if (retval != RSI_ERROR_NONE) {
+    return RSI_ERROR_SEMAPHORE_CREATE_FAILED;
+  }
+#endif
+#if RSI_TX_GATHER_MIN_LEN
+  retval = rsi_semaphore_create(&rsi_driver_cb_non_rom->tx_gather_sem, 0);
+  if (retval != RSI_ERROR_NONE) {
+    return RSI_ERROR_SEMAPHORE_CREATE_FAILED;
+  }
 #endif
   return retval;
 }
@@ -1626,7 +1638,7 @@ void rsi_check_pkt_queue_and_dequeue(void)
     // dequeue the packet from wlan queue
     pkt = (rsi_pkt_t *)rsi_dequeue_pkt(&rsi_driver_cb->wlan_tx_q);
     // free the packet
-    rsi_pkt_free(&rsi_driver_cb->wlan_cb->wlan_tx_pool, pkt);
+    rsi_wlan_free_tx_pkt(pkt);
   }
 #if (defined(RSI_BT_ENABLE) || defined(RSI_BLE_ENABLE) || defined(RSI_PROP_PROTOCOL_ENABLE))
   // check for packet pending in bt/ble queue
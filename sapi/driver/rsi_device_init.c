@@ -34,6 +34,11 @@
 int16_t rsi_secure_ping_pong_wr(uint32_t ping_pong, uint8_t *src_addr, uint16_t size_param);
 #endif
 
+// Host interact register value of the firmware upgrade in progress, selects the next ping or pong buffer
+static uint16_t rsi_bl_boot_cmd;
+// Host interact register value acknowledging the last written chunk, 0 if none pending
+static uint16_t rsi_bl_pending_resp;
+
 /** @addtogroup DRIVER5
 * @{
 */
@@ -254,6 +259,43 @@ int16_t rsi_bl_select_option(uint8_t cmd)
   return retval;
 }
 /** @} */
+/*==============================================*/
+/**
+ * @fn          static int16_t rsi_bl_wait_chunk_ack(void)
+ * @brief       Wait for the bootloader to take the last chunk written by \ref rsi_bl_upgrade_firmware(),
+ *              if any, freeing the other ping or pong buffer.
+ * @param[in]   void
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ */
+/// @private
+static int16_t rsi_bl_wait_chunk_ack(void)
+{
+  uint16_t read_value = 0;
+  int16_t retval      = 0;
+  rsi_timer_instance_t timer_instance;
+
+  if (!rsi_bl_pending_resp) {
+    return RSI_SUCCESS;
+  }
+  rsi_init_timer(&timer_instance, 1000);
+
+  while (1) {
+    retval = rsi_bootloader_instructions(RSI_REG_READ, &read_value);
+    if (retval < 0) {
+      break;
+    }
+    if (read_value == rsi_bl_pending_resp) {
+      break;
+    }
+    if (rsi_timer_expired(&timer_instance)) {
+      retval = RSI_ERROR_FW_UPGRADE_TIMEOUT;
+      break;
+    }
+  }
+  rsi_bl_pending_resp = 0;
+  return retval;
+}
 /** @addtogroup COMMON
 * @{
 */
@@ -280,6 +322,9 @@ int16_t rsi_bl_select_option(uint8_t cmd)
  *                 it will take approx. 65 sec duration for upgrading the firmware of 1.5 MB file. 
  * @note        3. For Fast firmware upgrade via the bootloader, \n
  *                 it will take approx. 35 sec duration for upgrading the firmware of 1.5 MB file.                
+ * @note        4. The API returns once the last chunk is written, without waiting for the bootloader to take it,
+ *                 so the next chunk can be fetched meanwhile. A timeout of the bootloader is then reported
+ *                 by the next call.
  * @return      0              - Success \n 
  *              Non-Zero Value - Failure
  *              
@@ -287,16 +332,17 @@ int16_t rsi_bl_select_option(uint8_t cmd)
 
 int16_t rsi_bl_upgrade_firmware(uint8_t *firmware_image, uint32_t fw_image_size, uint8_t flags)
 {
-  static uint16_t boot_cmd;
+  uint16_t boot_cmd;
   uint16_t read_value = 0;
   uint32_t offset     = 0;
   int16_t retval      = 0;
-  uint32_t boot_insn = 0, poll_resp = 0;
+  uint32_t boot_insn  = 0;
   rsi_timer_instance_t timer_instance;
 
   // If it is a start of file set the boot cmd to pong valid
   if (flags & RSI_FW_START_OF_FILE) {
-    boot_cmd = RSI_HOST_INTERACT_REG_VALID | RSI_PONG_VALID;
+    rsi_bl_boot_cmd     = RSI_HOST_INTERACT_REG_VALID | RSI_PONG_VALID;
+    rsi_bl_pending_resp = 0;
   }
 
   // check for invalid packet
@@ -306,17 +352,23 @@ int16_t rsi_bl_upgrade_firmware(uint8_t *firmware_image, uint32_t fw_image_size,
 
   // loop to execute multiple of 4K chunks
   while (offset < fw_image_size) {
-    switch (boot_cmd) {
+    // Wait for the buffer to write, bootloader frees it once it takes the previous chunk
+    retval = rsi_bl_wait_chunk_ack();
+    if (retval < 0) {
+      return retval;
+    }
+
+    switch (rsi_bl_boot_cmd) {
       case (RSI_HOST_INTERACT_REG_VALID | RSI_PING_VALID):
-        boot_insn = RSI_PONG_WRITE;
-        poll_resp = RSI_PING_AVAIL;
-        boot_cmd  = RSI_HOST_INTERACT_REG_VALID | RSI_PONG_VALID;
+        boot_insn           = RSI_PONG_WRITE;
+        rsi_bl_pending_resp = RSI_HOST_INTERACT_REG_VALID | RSI_PING_AVAIL;
+        rsi_bl_boot_cmd     = RSI_HOST_INTERACT_REG_VALID | RSI_PONG_VALID;
         break;
 
       case (RSI_HOST_INTERACT_REG_VALID | RSI_PONG_VALID):
-        boot_insn = RSI_PING_WRITE;
-        poll_resp = RSI_PONG_AVAIL;
-        boot_cmd  = RSI_HOST_INTERACT_REG_VALID | RSI_PING_VALID;
+        boot_insn           = RSI_PING_WRITE;
+        rsi_bl_pending_resp = RSI_HOST_INTERACT_REG_VALID | RSI_PONG_AVAIL;
+        rsi_bl_boot_cmd     = RSI_HOST_INTERACT_REG_VALID | RSI_PING_VALID;
         break;
       default: {
       }
@@ -324,28 +376,18 @@ int16_t rsi_bl_upgrade_firmware(uint8_t *firmware_image, uint32_t fw_image_size,
 
     retval = rsi_bootloader_instructions(boot_insn, (uint16_t *)((uint8_t *)firmware_image + offset));
     if (retval < 0) {
+      rsi_bl_pending_resp = 0;
       return retval;
     }
-
-    rsi_init_timer(&timer_instance, 1000);
-
-    while (1) {
-      retval = rsi_bootloader_instructions(RSI_REG_READ, &read_value);
-      if (retval < 0) {
-        return retval;
-      }
-      if (read_value == (RSI_HOST_INTERACT_REG_VALID | poll_resp)) {
-        break;
-      }
-      if (rsi_timer_expired(&timer_instance)) {
-        return RSI_ERROR_FW_UPGRADE_TIMEOUT;
-      }
-    }
     offset += RSI_MIN_CHUNK_SIZE;
   }
 
   // For last chunk set boot cmd as End of file reached
   if (flags & RSI_FW_END_OF_FILE) {
+    retval = rsi_bl_wait_chunk_ack();
+    if (retval < 0) {
+      return retval;
+    }
     boot_cmd = RSI_HOST_INTERACT_REG_VALID | RSI_EOF_REACHED;
 
     retval = rsi_bootloader_instructions(RSI_REG_WRITE, &boot_cmd);
@@ -367,6 +409,57 @@ int16_t rsi_bl_upgrade_firmware(uint8_t *firmware_image, uint32_t fw_image_size,
   }
   return retval;
 }
+
+/*==============================================*/
+/**
+ * @fn          int16_t rsi_bl_upgrade_firmware_stream(rsi_fw_image_reader_t reader, void *context, uint32_t fw_image_size,
+ *                                                     uint8_t *chunk_buf)
+ * @brief       Upgrade the firmware in the WiSeConnect device from the host, reading the firmware file in chunks
+ *              from the given reader, so it does not have to be in RAM. Each chunk is read while the bootloader
+ *              is still taking the previous one. This is blocking API.
+ * @param[in]   reader        - Called to read each chunk of the firmware file, in order
+ * @param[in]   context       - Passed to reader
+ * @param[in]   fw_image_size - Size of the firmware file
+ * @param[in]   chunk_buf     - Buffer of \ref RSI_MIN_CHUNK_SIZE bytes the chunks are read into
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure, or error returned by reader
+ * @note        Reader is called once per 4096 bytes, it is also the place to service a watchdog from.
+ */
+int16_t rsi_bl_upgrade_firmware_stream(rsi_fw_image_reader_t reader,
+                                       void *context,
+                                       uint32_t fw_image_size,
+                                       uint8_t *chunk_buf)
+{
+  uint32_t offset = 0;
+  uint16_t len;
+  uint8_t flags;
+  int16_t retval;
+
+  if ((reader == NULL) || (chunk_buf == NULL) || !fw_image_size) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  do {
+    len    = (fw_image_size - offset > RSI_MIN_CHUNK_SIZE) ? RSI_MIN_CHUNK_SIZE : (uint16_t)(fw_image_size - offset);
+    retval = reader(context, offset, chunk_buf, len);
+    if (retval != RSI_SUCCESS) {
+      return retval;
+    }
+    // Whole ping or pong buffer is written, pad the last chunk
+    memset(&chunk_buf[len], 0, RSI_MIN_CHUNK_SIZE - len);
+
+    flags = (offset == 0) ? RSI_FW_START_OF_FILE : 0;
+    offset += len;
+    if (offset == fw_image_size) {
+      flags |= RSI_FW_END_OF_FILE;
+    }
+    retval = rsi_bl_upgrade_firmware(chunk_buf, len, flags);
+    if (retval < 0) {
+      return retval;
+    }
+  } while (offset < fw_image_size);
+
+  return retval;
+}
 /** @} */
 /** @addtogroup DRIVER5
 * @{
@@ -439,6 +532,7 @@ int16_t rsi_bootloader_instructions(uint8_t type, uint16_t *data)
   uint16_t local     = 0;
   uint16_t read_data = 0;
   rsi_timer_instance_t timer_instance;
+  rsi_mem_access_t access[(RSI_PING_PONG_CHUNK_SIZE + RSI_HAL_MAX_WR_BUFF_LEN - 1) / RSI_HAL_MAX_WR_BUFF_LEN + 1];
 
   switch (type) {
     case RSI_REG_READ:
@@ -450,46 +544,23 @@ int16_t rsi_bootloader_instructions(uint8_t type, uint16_t *data)
       retval = rsi_mem_wr(RSI_HOST_INTF_REG_IN, 2, (uint8_t *)data);
       break;
     case RSI_PING_WRITE:
-
-      for (j = 0; j <= RSI_PING_PONG_CHUNK_SIZE / RSI_HAL_MAX_WR_BUFF_LEN; j++) {
-        if (j == RSI_PING_PONG_CHUNK_SIZE / RSI_HAL_MAX_WR_BUFF_LEN) {
-          len = (RSI_PING_PONG_CHUNK_SIZE % RSI_HAL_MAX_WR_BUFF_LEN);
-          if (len == 0) {
-            break;
-          }
-        } else {
-          len = RSI_HAL_MAX_WR_BUFF_LEN;
-        }
-        retval = rsi_mem_wr(RSI_PING_BUFFER_ADDR + offset, len, (uint8_t *)((uint32_t)data + offset));
-        if (retval < 0) {
-          return retval;
-        }
-        offset += len;
-      }
-      local  = (RSI_PING_AVAIL | RSI_HOST_INTERACT_REG_VALID);
-      retval = rsi_mem_wr(RSI_HOST_INTF_REG_IN, 2, (uint8_t *)&local);
-      break;
     case RSI_PONG_WRITE:
-
-      for (j = 0; j <= RSI_PING_PONG_CHUNK_SIZE / RSI_HAL_MAX_WR_BUFF_LEN; j++) {
-        if (j == RSI_PING_PONG_CHUNK_SIZE / RSI_HAL_MAX_WR_BUFF_LEN) {
-          len = (RSI_PING_PONG_CHUNK_SIZE % RSI_HAL_MAX_WR_BUFF_LEN);
-          if (len == 0) {
-            break;
-          }
-        } else {
-          len = RSI_HAL_MAX_WR_BUFF_LEN;
-        }
-        retval = rsi_mem_wr(RSI_PONG_BUFFER_ADDR + offset, len, (uint8_t *)((uint32_t)data + offset));
-        if (retval < 0) {
-          return retval;
-        }
+      // Write the chunk in HAL sized pieces, then tell the bootloader which buffer holds it
+      for (j = 0; offset < RSI_PING_PONG_CHUNK_SIZE; j++) {
+        len = (RSI_PING_PONG_CHUNK_SIZE - offset > RSI_HAL_MAX_WR_BUFF_LEN) ? RSI_HAL_MAX_WR_BUFF_LEN
+                                                                            : (RSI_PING_PONG_CHUNK_SIZE - offset);
+        access[j].addr  = ((type == RSI_PING_WRITE) ? RSI_PING_BUFFER_ADDR : RSI_PONG_BUFFER_ADDR) + offset;
+        access[j].buf   = (uint8_t *)data + offset;
+        access[j].len   = len;
+        access[j].flags = RSI_MEM_ACCESS_WRITE;
         offset += len;
       }
-      // Perform the write operation
-      local = (RSI_PONG_AVAIL | RSI_HOST_INTERACT_REG_VALID);
-
-      retval = rsi_mem_wr(RSI_HOST_INTF_REG_IN, 2, (uint8_t *)&local);
+      local           = ((type == RSI_PING_WRITE) ? RSI_PING_AVAIL : RSI_PONG_AVAIL) | RSI_HOST_INTERACT_REG_VALID;
+      access[j].addr  = RSI_HOST_INTF_REG_IN;
+      access[j].buf   = (uint8_t *)&local;
+      access[j].len   = 2;
+      access[j].flags = RSI_MEM_ACCESS_WRITE;
+      retval          = (int16_t)rsi_mem_access_batch(access, j + 1);
       break;
     case BURN_NWP_FW:
 
@@ -561,6 +632,123 @@ int32_t rsi_get_ram_dump(uint32_t addr, uint16_t length, uint8_t *buf)
 /** @} */
 #endif
 #endif
+
+/** @addtogroup COMMON
+* @{
+*/
+/*==============================================*/
+/**
+ * @fn          static int16_t rsi_mem_access_run(const rsi_mem_access_t *access, uint16_t count, uint16_t len,
+ *                                                  uint8_t adjacent)
+ * @brief       Perform merged module memory access of adjacent accesses, through the bounce buffer if their
+ *              buffers are not adjacent too.
+ * @param[in]   access   - accesses to perform, to adjacent module addresses and in the same direction
+ * @param[in]   count    - number of accesses
+ * @param[in]   len      - total length of accesses
+ * @param[in]   adjacent - 1 if buffers of accesses are adjacent too
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ */
+static int16_t rsi_mem_access_run(const rsi_mem_access_t *access, uint16_t count, uint16_t len, uint8_t adjacent)
+{
+#if RSI_MEM_BATCH_BOUNCE_LEN
+  uint8_t bounce[RSI_MEM_BATCH_BOUNCE_LEN];
+  uint16_t offset = 0;
+  uint16_t i;
+  int16_t retval;
+#endif
+
+  if (adjacent) {
+    if (access[0].flags & RSI_MEM_ACCESS_WRITE) {
+      return rsi_mem_wr(access[0].addr, len, access[0].buf);
+    }
+    return rsi_mem_rd(access[0].addr, len, access[0].buf);
+  }
+#if RSI_MEM_BATCH_BOUNCE_LEN
+  if (access[0].flags & RSI_MEM_ACCESS_WRITE) {
+    for (i = 0; i < count; i++) {
+      memcpy(&bounce[offset], access[i].buf, access[i].len);
+      offset += access[i].len;
+    }
+    return rsi_mem_wr(access[0].addr, len, bounce);
+  }
+  retval = rsi_mem_rd(access[0].addr, len, bounce);
+  if (retval != RSI_SUCCESS) {
+    return retval;
+  }
+  for (i = 0; i < count; i++) {
+    memcpy(access[i].buf, &bounce[offset], access[i].len);
+    offset += access[i].len;
+  }
+  return retval;
+#else
+  return RSI_ERROR_INVALID_PARAM;
+#endif
+}
+
+/*==============================================*/
+/**
+ * @fn          int32_t rsi_mem_access_batch(const rsi_mem_access_t *access, uint16_t count)
+ * @brief       Perform a sequence of module memory reads and writes, in order, using as few bus transactions as
+ *              possible. Consecutive accesses in the same direction to adjacent addresses are merged into one,
+ *              up to \ref RSI_MEM_BATCH_MAX_LEN bytes, and on SDIO the memory window is written only when it
+ *              changes. This is blocking API.
+ * @param[in]   access - accesses to perform, reads are complete on return
+ * @param[in]   count  - number of accesses
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure, accesses after the failing one are not performed
+ * @note        Accesses flagged \ref RSI_MEM_ACCESS_NO_MERGE, registers with side effects on access width,
+ *              are always performed on their own.
+ */
+int32_t rsi_mem_access_batch(const rsi_mem_access_t *access, uint16_t count)
+{
+  int32_t retval = RSI_SUCCESS;
+  uint16_t i     = 0;
+  uint16_t j;
+  uint16_t len;
+  uint8_t adjacent;
+
+  if ((access == NULL) && count) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  for (j = 0; j < count; j++) {
+    if (!access[j].len || (access[j].buf == NULL)) {
+      return RSI_ERROR_INVALID_PARAM;
+    }
+  }
+#ifdef RSI_SDIO_INTERFACE
+  rsi_sdio_mem_window_hold(1);
+#endif
+  while (i < count) {
+    len      = access[i].len;
+    adjacent = 1;
+    for (j = i + 1; (j < count) && !(access[i].flags & RSI_MEM_ACCESS_NO_MERGE); j++) {
+      if ((access[j].flags != access[i].flags) || (access[j].addr != access[i].addr + len)
+          || ((uint32_t)len + access[j].len > RSI_MEM_BATCH_MAX_LEN)) {
+        break;
+      }
+      if (adjacent && (access[j].buf != access[i].buf + len)) {
+        if ((uint32_t)len + access[j].len > RSI_MEM_BATCH_BOUNCE_LEN) {
+          break;
+        }
+        adjacent = 0;
+      } else if (!adjacent && ((uint32_t)len + access[j].len > RSI_MEM_BATCH_BOUNCE_LEN)) {
+        break;
+      }
+      len += access[j].len;
+    }
+    retval = rsi_mem_access_run(&access[i], j - i, len, adjacent);
+    if (retval != RSI_SUCCESS) {
+      break;
+    }
+    i = j;
+  }
+#ifdef RSI_SDIO_INTERFACE
+  rsi_sdio_mem_window_hold(0);
+#endif
+  return retval;
+}
+/** @} */
 #endif
 #endif
 #endif
@@ -50,20 +50,261 @@ rsi_driver_cb_non_rom_t *rsi_driver_cb_non_rom = NULL;
 #endif
 #define ZB_PKT   5
 #define WLAN_PKT 6
+
+#if ((RSI_RX_DRAIN_BUDGET > 1) \
+     && ((defined RSI_SPI_INTERFACE) || ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))))
+#define RSI_RX_DRAIN_ENABLE 1
+#endif
 /** @addtogroup DRIVER8
 * @{
 */
 /*==============================================*/
 /**
- * @fn          void rsi_tx_event_handler(void)
- * @brief       Retrieve the packet from protocol TX pending queue
- *              and forwards to the module.
- * @param[in]   void 
+ * @fn          void rsi_tx_arb_init(rsi_tx_arb_cb_t *arb, const rsi_driver_config_t *config)
+ * @brief       Initialize TX queue arbitration state from driver configuration.
+ * @param[in]   arb    - Pointer to TX arbitration control block
+ * @param[in]   config - Pointer to driver configuration
  * @return      void
  *
  */
+/// @private
+void rsi_tx_arb_init(rsi_tx_arb_cb_t *arb, const rsi_driver_config_t *config)
+{
+  uint8_t i;
 
-void rsi_tx_event_handler(void)
+  memset(arb, 0, sizeof(rsi_tx_arb_cb_t));
+  arb->policy = config->tx_arb_policy;
+  for (i = 0; i < RSI_TX_ARB_MAX_Q; i++) {
+    arb->quantum[i]           = config->tx_arb_quantum[i];
+    arb->latency_target_ms[i] = config->tx_arb_latency_target_ms[i];
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn          static rsi_queue_cb_t *rsi_tx_arb_get_queue(uint8_t queue)
+ * @brief       Map a TX arbitration queue to the driver TX queue.
+ * @param[in]   queue - TX arbitration queue, one of rsi_tx_arb_queue_t
+ * @return      Pointer to driver TX queue, NULL if not enabled in this build
+ *
+ */
+static rsi_queue_cb_t *rsi_tx_arb_get_queue(uint8_t queue)
+{
+  switch (queue) {
+    case RSI_TX_ARB_COMMON_Q:
+      return &rsi_driver_cb->common_tx_q;
+#if (defined RSI_BT_ENABLE || defined RSI_BLE_ENABLE || defined RSI_PROP_PROTOCOL_ENABLE)
+    case RSI_TX_ARB_BT_Q:
+      return &rsi_driver_cb->bt_single_tx_q;
+#endif
+#ifdef RSI_PROP_PROTOCOL_ENABLE
+    case RSI_TX_ARB_PROP_PROTOCOL_Q:
+      return &rsi_driver_cb->prop_protocol_tx_q;
+#endif
+#ifdef RSI_ZB_ENABLE
+    case RSI_TX_ARB_ZB_Q:
+      return &rsi_driver_cb->zigb_tx_q;
+#endif
+    case RSI_TX_ARB_WLAN_Q:
+      return &rsi_driver_cb->wlan_tx_q;
+    default:
+      return NULL;
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn          static uint16_t rsi_tx_arb_head_length(uint8_t queue)
+ * @brief       Get length of the packet at the head of a TX queue.
+ * @param[in]   queue - TX arbitration queue, one of rsi_tx_arb_queue_t
+ * @return      Payload length of head packet, 0 if queue is empty
+ *
+ */
+static uint16_t rsi_tx_arb_head_length(uint8_t queue)
+{
+  rsi_queue_cb_t *tx_q = rsi_tx_arb_get_queue(queue);
+
+  // Only the TX event handler dequeues, so a non empty head stays valid here
+  if ((tx_q == NULL) || (tx_q->head == NULL)) {
+    return 0;
+  }
+  return (*(uint16_t *)tx_q->head->desc & 0x0FFF);
+}
+
+/*==============================================*/
+/**
+ * @fn          static uint8_t rsi_tx_arb_select(const uint8_t *pending)
+ * @brief       Select the TX queue to serve next as per configured arbitration policy.
+ *              Common queue carries control frames and is always served first.
+ * @param[in]   pending - Per queue packet pending flags, indexed by rsi_tx_arb_queue_t
+ * @return      Selected queue, RSI_TX_ARB_MAX_Q if nothing is pending
+ *
+ */
+static uint8_t rsi_tx_arb_select(const uint8_t *pending)
+{
+  rsi_tx_arb_cb_t *arb = &rsi_driver_cb_non_rom->tx_arb;
+  uint32_t now         = rsi_hal_gettickcount();
+  uint32_t overdue     = 0;
+  uint32_t waited;
+  uint8_t selected = RSI_TX_ARB_MAX_Q;
+  uint8_t queue;
+  uint8_t visits;
+
+  // Track since when each head packet is waiting
+  for (queue = 0; queue < RSI_TX_ARB_MAX_Q; queue++) {
+    if (pending[queue]) {
+      if (!(arb->hol_valid & BIT(queue))) {
+        arb->hol_since[queue] = now;
+        arb->hol_valid |= BIT(queue);
+      }
+    } else {
+      arb->hol_valid &= ~BIT(queue);
+      arb->deficit[queue] = 0;
+    }
+  }
+
+  if (pending[RSI_TX_ARB_COMMON_Q]) {
+    return RSI_TX_ARB_COMMON_Q;
+  }
+
+  if (arb->policy == RSI_TX_ARB_LATENCY_TARGET) {
+    // Serve the queue most past its latency target, if any
+    for (queue = 0; queue < RSI_TX_ARB_MAX_Q; queue++) {
+      if (!pending[queue] || !arb->latency_target_ms[queue]) {
+        continue;
+      }
+      waited = now - arb->hol_since[queue];
+      if ((waited >= arb->latency_target_ms[queue]) && ((waited - arb->latency_target_ms[queue]) >= overdue)) {
+        overdue  = waited - arb->latency_target_ms[queue];
+        selected = queue;
+      }
+    }
+  } else if (arb->policy == RSI_TX_ARB_DRR) {
+    for (visits = 0; visits < (2 * RSI_TX_ARB_MAX_Q); visits++) {
+      queue = arb->drr_current;
+      if (pending[queue]) {
+        if (!arb->drr_quantum_added) {
+          arb->deficit[queue] += arb->quantum[queue];
+          arb->drr_quantum_added = 1;
+        }
+        if (arb->deficit[queue] >= rsi_tx_arb_head_length(queue)) {
+          selected = queue;
+          break;
+        }
+      }
+      // Pass the turn to next queue
+      arb->drr_quantum_added = 0;
+      arb->drr_current       = (queue + 1) % RSI_TX_ARB_MAX_Q;
+    }
+  }
+
+  if (selected == RSI_TX_ARB_MAX_Q) {
+    // Strict priority, also the fallback when above policies do not pick a queue
+    for (queue = 0; queue < RSI_TX_ARB_MAX_Q; queue++) {
+      if (pending[queue]) {
+        selected = queue;
+        break;
+      }
+    }
+  }
+  return selected;
+}
+
+/*==============================================*/
+/**
+ * @fn          static void rsi_tx_arb_served(uint8_t queue, uint16_t length)
+ * @brief       Account a frame written to module from a TX queue.
+ * @param[in]   queue  - TX arbitration queue, one of rsi_tx_arb_queue_t
+ * @param[in]   length - Payload length of the frame
+ * @return      void
+ *
+ */
+static void rsi_tx_arb_served(uint8_t queue, uint16_t length)
+{
+  rsi_tx_arb_cb_t *arb = &rsi_driver_cb_non_rom->tx_arb;
+  uint32_t now         = rsi_hal_gettickcount();
+  uint32_t waited      = now - arb->hol_since[queue];
+
+  arb->stats[queue].frames++;
+  arb->stats[queue].bytes += length;
+  arb->stats[queue].wait_time_ms += waited;
+  if (waited > arb->stats[queue].max_wait_time_ms) {
+    arb->stats[queue].max_wait_time_ms = waited;
+  }
+  if (arb->deficit[queue] > length) {
+    arb->deficit[queue] -= length;
+  } else {
+    arb->deficit[queue] = 0;
+  }
+  // Next packet in this queue reaches the head now
+  arb->hol_since[queue] = now;
+}
+
+#if ((defined RSI_SPI_INTERFACE) || (defined RSI_M4_INTERFACE) \
+     || ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM)))
+/*==============================================*/
+/**
+ * @fn          static void rsi_tx_credits_update(uint8_t int_status, uint8_t grant)
+ * @brief       Refresh module TX credits from a read of the interrupt status register.
+ * @param[in]   int_status - Interrupt status register value
+ * @param[in]   grant      - 1 if read right before writing a frame, so credits are granted when buffers are free \n
+ *                           0 if read by the RX path, which can be stale by the time a frame is written, so
+ *                           credits are only revoked when a buffer is full
+ * @return      void
+ *
+ */
+static void rsi_tx_credits_update(uint8_t int_status, uint8_t grant)
+{
+  uint8_t full_mask = RSI_BUFFER_FULL;
+
+#ifdef RSI_BT_ENABLE
+  full_mask |= BIT(1);
+#endif
+#if (defined RSI_BLE_ENABLE || defined RSI_PROP_PROTOCOL_ENABLE)
+  full_mask |= BIT(2);
+#endif
+  // Any buffer full keeps the register read before each frame till module frees buffers
+  if (int_status & full_mask) {
+    rsi_driver_cb_non_rom->module_tx_credits = 0;
+  } else if (grant) {
+    rsi_driver_cb_non_rom->module_tx_credits = RSI_MODULE_TX_CREDITS;
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn          static int16_t rsi_tx_credits_check(uint8_t *int_status)
+ * @brief       Read the interrupt status register for buffer full before writing a frame.
+ * @param[out]  int_status - Interrupt status register value
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ *
+ */
+static int16_t rsi_tx_credits_check(uint8_t *int_status)
+{
+  int16_t status = rsi_device_interrupt_status(int_status);
+
+  if (status == 0x0) {
+    rsi_tx_credits_update(*int_status, 1);
+  }
+  return status;
+}
+#endif
+
+/*==============================================*/
+/**
+ * @fn          static uint8_t rsi_tx_event_send_pkt(uint8_t check_buffer_full)
+ * @brief       Retrieve one packet from protocol TX pending queue
+ *              and forward it to the module.
+ * @param[in]   check_buffer_full - 1 to read the interrupt status register for
+ *                                  buffer full before writing the frame \n
+ *                                  0 to skip the check (module TX credits left)
+ * @return      1 - Frame written and further frames may follow in the same burst \n
+ *              0 - Nothing more to send in this invocation
+ *
+ */
+
+static uint8_t rsi_tx_event_send_pkt(uint8_t check_buffer_full)
 {
   rsi_pkt_t *pkt = NULL;
   uint8_t *buf_ptr;
@@ -92,23 +333,17 @@ void rsi_tx_event_handler(void)
   uint8_t queueno = 0xff;
   uint8_t frame_type;
   uint8_t pkt_dequeued = 0xff;
+  uint8_t tx_arb_pending[RSI_TX_ARB_MAX_Q] = { 0 };
+  uint8_t tx_arb_queue;
+#ifndef RSI_M4_INTERFACE
+  rsi_frame_iovec_t iov[2];
+#endif
 
 #if ((defined RSI_BT_ENABLE || defined RSI_BLE_ENABLE || defined RSI_PROP_PROTOCOL_ENABLE) \
      && (defined RSI_M4_INTERFACE))
   rsi_bt_cb_t *bt_cb;
 #endif
 
-#ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
-  if (!rsi_driver_cb_non_rom->driver_timer_start) {
-    rsi_init_timer(&rsi_driver_cb_non_rom->timer_start, RSI_TX_EVENT_WAIT_TIME);
-    rsi_driver_cb_non_rom->driver_timer_start = 1;
-  }
-  if ((rsi_timer_expired(&rsi_driver_cb_non_rom->timer_start)) && (rsi_driver_cb_non_rom->driver_timer_start == 1)) {
-    rsi_error_timeout_and_clear_events(RSI_ERROR_TX_BUFFER_FULL, TX_EVENT_CMD);
-    return;
-  }
-#endif
-
 #ifdef RSI_M4_INTERFACE
 
   if (rsi_driver_cb->rsi_tx_done_handler != NULL) {
@@ -173,7 +408,7 @@ void rsi_tx_event_handler(void)
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
       rsi_error_timeout_and_clear_events(status, TX_EVENT_CMD);
 #endif
-      return;
+      return 0;
     }
 #else
     status = rsi_req_wakeup();
@@ -181,7 +416,7 @@ void rsi_tx_event_handler(void)
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
       rsi_error_timeout_and_clear_events(status, TX_EVENT_CMD);
 #endif
-      return;
+      return 0;
     }
 #endif
 #else
@@ -200,7 +435,9 @@ void rsi_tx_event_handler(void)
 #endif
   ) {
     // Read interrupt status register to check buffer full condition
-    ret_status = rsi_device_interrupt_status(&int_status);
+    if (check_buffer_full) {
+      ret_status = rsi_tx_credits_check(&int_status);
+    }
 
     // if buffer full then return without clearing Tx event
     if ((ret_status != 0x0)
@@ -215,7 +452,7 @@ void rsi_tx_event_handler(void)
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
         rsi_error_timeout_and_clear_events(ret_status, TX_EVENT_CMD);
 #endif
-        return;
+        return 0;
       }
       bt_pkt_pending = 0;
 #ifdef RSI_PROP_PROTOCOL_ENABLE
@@ -238,12 +475,49 @@ void rsi_tx_event_handler(void)
 #endif
 #endif
 
+  // Pick one queue to serve as per TX arbitration policy
+  tx_arb_pending[RSI_TX_ARB_COMMON_Q] = common_pkt_pending;
+#ifdef SAPIS_BT_STACK_ON_HOST
+  tx_arb_pending[RSI_TX_ARB_BT_Q] = bt_ble_stack_pkt_pending;
+#else
+  tx_arb_pending[RSI_TX_ARB_BT_Q] = bt_pkt_pending;
+#endif
+#ifdef RSI_PROP_PROTOCOL_ENABLE
+  tx_arb_pending[RSI_TX_ARB_PROP_PROTOCOL_Q] = prop_protocol_pkt_pending;
+#endif
+  tx_arb_pending[RSI_TX_ARB_ZB_Q]   = zb_pkt_pending;
+  tx_arb_pending[RSI_TX_ARB_WLAN_Q] = wlan_pkt_pending;
+
+  tx_arb_queue = rsi_tx_arb_select(tx_arb_pending);
+  if (tx_arb_queue != RSI_TX_ARB_COMMON_Q) {
+    common_pkt_pending = 0;
+  }
+  if (tx_arb_queue != RSI_TX_ARB_BT_Q) {
+#ifdef SAPIS_BT_STACK_ON_HOST
+    bt_ble_stack_pkt_pending = 0;
+#endif
+    bt_pkt_pending = 0;
+  }
+#ifdef RSI_PROP_PROTOCOL_ENABLE
+  if (tx_arb_queue != RSI_TX_ARB_PROP_PROTOCOL_Q) {
+    prop_protocol_pkt_pending = 0;
+  }
+#endif
+  if (tx_arb_queue != RSI_TX_ARB_ZB_Q) {
+    zb_pkt_pending = 0;
+  }
+  if (tx_arb_queue != RSI_TX_ARB_WLAN_Q) {
+    wlan_pkt_pending = 0;
+  }
+
   if (common_pkt_pending) {
 #if ((defined RSI_SPI_INTERFACE) || (defined RSI_M4_INTERFACE) \
      || ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM)))
     rsi_driver_cb->rsi_tx_done_handler = &rsi_common_packet_transfer_done;
     // Read interrupt status register to check buffer full condition
-    ret_status = rsi_device_interrupt_status(&int_status);
+    if (check_buffer_full) {
+      ret_status = rsi_tx_credits_check(&int_status);
+    }
 
     // if buffer full then return without clearing Tx event
     if ((ret_status != 0x0) || (int_status & RSI_BUFFER_FULL)) {
@@ -251,7 +525,7 @@ void rsi_tx_event_handler(void)
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
         rsi_error_timeout_and_clear_events(ret_status, TX_EVENT_CMD);
 #endif
-        return;
+        return 0;
       }
       // Mask the TX event until RX event is served
       if (rsi_driver_cb->scheduler_cb.event_map & ~(BIT(RSI_TX_EVENT))) {
@@ -272,10 +546,10 @@ void rsi_tx_event_handler(void)
 #endif
       // if fail , return or
       // if buffer full then return without clearing Tx event
-      return;
+      return 0;
 #else
       // if buffer full then return without clearing Tx event
-      return;
+      return 0;
 #endif
     }
 #endif
@@ -334,7 +608,9 @@ void rsi_tx_event_handler(void)
 #if ((defined RSI_SPI_INTERFACE) || (defined RSI_M4_INTERFACE) \
      || ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM)))
     // Read interrupt status register to check buffer full condition
-    ret_status = rsi_device_interrupt_status(&int_status);
+    if (check_buffer_full) {
+      ret_status = rsi_tx_credits_check(&int_status);
+    }
 
     // if buffer full then return without clearing Tx event
     if ((ret_status != 0x0) || (int_status & RSI_BUFFER_FULL)) {
@@ -342,7 +618,7 @@ void rsi_tx_event_handler(void)
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
         rsi_error_timeout_and_clear_events(ret_status, TX_EVENT_CMD);
 #endif
-        return;
+        return 0;
       }
       // Mask the TX event until RX event is served
       if (rsi_driver_cb->scheduler_cb.event_map & ~(BIT(RSI_TX_EVENT))) {
@@ -363,10 +639,10 @@ void rsi_tx_event_handler(void)
       rsi_check_wlan_buffer_full(pkt);
       // if fail , return or
       // if buffer full then return without clearing Tx event
-      return;
+      return 0;
 #else
       // if buffer full then return without clearing Tx event
-      return;
+      return 0;
 #endif
     }
 
@@ -418,17 +694,34 @@ void rsi_tx_event_handler(void)
 #ifdef RSI_M4_INTERFACE
     rsi_mask_event(RSI_TX_EVENT);
 #endif
-    // Writing to Module
-    status = rsi_frame_write((rsi_frame_desc_t *)buf_ptr, &buf_ptr[RSI_HOST_DESC_LENGTH], length);
+#ifndef RSI_M4_INTERFACE
+    if (rsi_pkt_detach_payload(pkt, &iov[1])) {
+      // Payload in the packet is followed by the external payload attached to it
+      iov[0].buffer = &buf_ptr[RSI_HOST_DESC_LENGTH];
+      iov[0].length = (length - iov[1].length);
+
+      // Writing to Module
+      status = rsi_frame_writev((rsi_frame_desc_t *)buf_ptr, iov, 2);
+      rsi_pkt_payload_written(pkt);
+    } else
+#endif
+    {
+      // Writing to Module
+      status = rsi_frame_write((rsi_frame_desc_t *)buf_ptr, &buf_ptr[RSI_HOST_DESC_LENGTH], length);
+    }
     if (status < 0x0) {
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
       rsi_error_timeout_and_clear_events(status, TX_EVENT_CMD);
 #endif
-      return;
+      return 0;
     }
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
     rsi_driver_cb_non_rom->driver_timer_start = 0;
 #endif
+    rsi_tx_arb_served(tx_arb_queue, length);
+    if (rsi_driver_cb_non_rom->module_tx_credits) {
+      rsi_driver_cb_non_rom->module_tx_credits--;
+    }
 #ifdef RSI_M4_INTERFACE
     if ((queueno == RSI_WLAN_MGMT_Q) && (frame_type == RSI_COMMON_REQ_SOFT_RESET)) {
       rsi_config_m4_dma_desc_on_reset();
@@ -439,7 +732,7 @@ void rsi_tx_event_handler(void)
       // signal semaphore incase of packet having async response
       rsi_common_packet_transfer_done(pkt);
     }
-    return;
+    return 0;
 #endif
 #ifndef RSI_M4_INTERFACE
     if (pkt_dequeued == COMMON_PKT) {
@@ -487,6 +780,7 @@ void rsi_tx_event_handler(void)
       }
 #endif
     }
+    return 1;
   } else {
 #ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
     rsi_driver_cb_non_rom->driver_timer_start = 0;
@@ -498,7 +792,7 @@ void rsi_tx_event_handler(void)
       bt_pkt_pending = rsi_check_queue_status(&rsi_driver_cb->bt_single_tx_q);
 
       if (bt_pkt_pending) {
-        return;
+        return 0;
       }
     }
 #ifdef RSI_PROP_PROTOCOL_ENABLE
@@ -506,7 +800,7 @@ void rsi_tx_event_handler(void)
       prop_protocol_pkt_pending = rsi_check_queue_status(&rsi_driver_cb->prop_protocol_tx_q);
 
       if (prop_protocol_pkt_pending) {
-        return;
+        return 0;
       }
     }
 #endif
@@ -539,6 +833,47 @@ void rsi_tx_event_handler(void)
 #endif
     rsi_clear_event(RSI_TX_EVENT);
   }
+  return 0;
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_tx_event_handler(void)
+ * @brief       Retrieve the packets from protocol TX pending queues
+ *              and forwards to the module. Up to RSI_TX_BURST_MAX_FRAMES
+ *              frames are written per invocation, buffer full is checked
+ *              only once module TX credits are used up.
+ * @param[in]   void 
+ * @return      void
+ *
+ */
+
+void rsi_tx_event_handler(void)
+{
+  uint16_t burst_count = 0;
+
+#ifndef RSI_TX_EVENT_HANDLE_TIMER_DISABLE
+  if (!rsi_driver_cb_non_rom->driver_timer_start) {
+    rsi_init_timer(&rsi_driver_cb_non_rom->timer_start, RSI_TX_EVENT_WAIT_TIME);
+    rsi_driver_cb_non_rom->driver_timer_start = 1;
+  }
+  if ((rsi_timer_expired(&rsi_driver_cb_non_rom->timer_start)) && (rsi_driver_cb_non_rom->driver_timer_start == 1)) {
+    rsi_error_timeout_and_clear_events(RSI_ERROR_TX_BUFFER_FULL, TX_EVENT_CMD);
+    return;
+  }
+#endif
+
+  do {
+    if (!rsi_tx_event_send_pkt(rsi_driver_cb_non_rom->module_tx_credits == 0)) {
+      break;
+    }
+    burst_count++;
+    // Stop the burst if TX got masked (power save/buffer full) or the module has something to report
+    if (!(rsi_driver_cb->scheduler_cb.mask_map & BIT(RSI_TX_EVENT))
+        || (rsi_driver_cb->scheduler_cb.event_map & BIT(RSI_RX_EVENT))) {
+      break;
+    }
+  } while (burst_count < RSI_TX_BURST_MAX_FRAMES);
 }
 /** @} */
 
@@ -546,10 +881,58 @@ void rsi_tx_event_handler(void)
 * @{
 */
 
+#ifdef RSI_RX_DRAIN_ENABLE
+/*==============================================*/
+/**
+ * @fn         static uint8_t rsi_rx_event_drain_next(uint16_t drain_count)
+ * @brief      Check whether the next frame can be read in the same RX event, without
+ *             re-arming the host interrupt.
+ * @param[in]  drain_count - Number of frames already read in this RX event
+ * @return     1 - Module has a frame pending and it can be read now \n
+ *             0 - Stop draining and re-arm the host interrupt
+ *
+ */
+static uint8_t rsi_rx_event_drain_next(uint16_t drain_count)
+{
+  uint8_t int_status = 0;
+
+  if (drain_count >= RSI_RX_DRAIN_BUDGET) {
+    return 0;
+  }
+
+  // Sleep/wakeup handshake is done once per RX event
+  if (rsi_driver_cb->common_cb->power_save.power_save_enable) {
+    return 0;
+  }
+
+  // RX event got masked while processing the frame
+  if (!(rsi_driver_cb->scheduler_cb.mask_map & BIT(RSI_RX_EVENT))) {
+    return 0;
+  }
+
+#ifdef RSI_SPI_INTERFACE
+  // Frame stays in module till an RX packet is available
+  if (!rsi_is_pkt_available(&rsi_driver_cb->rx_pool)) {
+    return 0;
+  }
+#endif
+
+  if (rsi_device_interrupt_status(&int_status) != RSI_SUCCESS) {
+    return 0;
+  }
+  rsi_tx_credits_update(int_status, 0);
+
+  // Assertion interrupt is served through the regular RX event path
+  return ((int_status & RSI_RX_PKT_PENDING) && !(int_status & RSI_ASSERT_INTR));
+}
+#endif
+
 /*==============================================*/
 /**
  * @fn         void rsi_rx_event_handler(void)
- * @brief      Read the packet from module and process RX packet.
+ * @brief      Read the packet from module and process RX packet. With RSI_RX_DRAIN_BUDGET
+ *             above 1, frames the module still has pending are read in the same event,
+ *             before the host interrupt is unmasked again.
  * @param[in]  void  
  * @return     void 
  *
@@ -557,6 +940,9 @@ void rsi_tx_event_handler(void)
 
 void rsi_rx_event_handler(void)
 {
+#ifdef RSI_RX_DRAIN_ENABLE
+  uint16_t drain_count = 0;
+#endif
   uint8_t queue_no;
   uint8_t frame_type;
   uint16_t status    = 0;
@@ -672,6 +1058,7 @@ void rsi_rx_event_handler(void)
 #endif
         return;
       }
+      rsi_tx_credits_update(int_status, 0);
 #endif //! (RSI_SPI_DUP_INTR_HANDLE || RSI_ASSERT_ENABLE)
 #if RSI_ASSERT_ENABLE
       // Check for assertion interrupt
@@ -733,6 +1120,9 @@ void rsi_rx_event_handler(void)
         return;
       }
 #endif
+#ifdef RSI_RX_DRAIN_ENABLE
+  do {
+#endif
 #if ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
 #else
 #ifndef RSI_M4_INTERFACE
@@ -944,7 +1334,10 @@ void rsi_rx_event_handler(void)
           rsi_wlan_process_raw_data(rx_pkt);
 #else
     // Process DATA packet
-    rsi_driver_process_recv_data(rx_pkt);
+    if (rsi_driver_process_recv_data(rx_pkt) == RSI_RX_PKT_LOANED) {
+      // Packet is owned by application now
+      rx_pkt = NULL;
+    }
 #endif
         }
 #endif
@@ -952,7 +1345,13 @@ void rsi_rx_event_handler(void)
 #if ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
 #else
   // Free the packet after processing
-  rsi_pkt_free(&rsi_driver_cb->rx_pool, rx_pkt);
+  if (rx_pkt != NULL) {
+    rsi_pkt_free(&rsi_driver_cb->rx_pool, rx_pkt);
+  }
+#endif
+#ifdef RSI_RX_DRAIN_ENABLE
+    // Read next frame right away while module reports more pending
+  } while (rsi_rx_event_drain_next(++drain_count));
 #endif
 #ifdef LINUX_PLATFORM
 #ifdef RSI_UART_INTERFACE
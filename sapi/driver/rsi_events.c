@@ -242,6 +242,61 @@ uint32_t rsi_find_event(uint32_t event_map)
 #endif
 }
 
+/*====================================================*/
+/**
+ * @fn          uint32_t rsi_event_ctz(uint32_t event_map)
+ * @brief       Find the lowest set event bit in the event map, used when the compiler has no
+ *              count trailing zeros intrinsic.
+ * @param[in]   event_map - Non-zero event map
+ * @return      Event number
+ */
+///@private
+uint32_t rsi_event_ctz(uint32_t event_map)
+{
+  static const uint8_t rsi_event_debruijn_pos[32] = { 0,  1,  28, 2,  29, 14, 24, 3, 30, 22, 20,
+                                                      15, 25, 17, 4,  8,  31, 27, 13, 23, 21, 19,
+                                                      16, 7,  26, 12, 18, 6,  11, 5,  10, 9 };
+
+  // Isolate lowest set bit and index the de Bruijn table with it
+  return rsi_event_debruijn_pos[((event_map & (0 - event_map)) * 0x077CB531U) >> 27];
+}
+
+/*====================================================*/
+/**
+ * @fn          int32_t rsi_set_event_priority(uint32_t event_num, uint8_t priority)
+ * @brief       Set dispatch priority of an event. Pending events of higher priority are handled first,
+ *              events of same priority are handled in event number order.
+ * @param[in]   event_num - Event number
+ * @param[in]   priority  - Priority, RSI_EVENT_PRIORITY_DEFAULT up to RSI_SCHEDULER_NUM_PRIORITIES - 1
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ */
+int32_t rsi_set_event_priority(uint32_t event_num, uint8_t priority)
+{
+  rsi_scheduler_cb_t *scheduler_cb;
+  rsi_reg_flags_t flags;
+  uint8_t i;
+
+  if ((event_num >= RSI_MAX_NUM_EVENTS) || (priority >= RSI_SCHEDULER_NUM_PRIORITIES)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  scheduler_cb = &rsi_driver_cb->scheduler_cb;
+
+  // Disable all the interrupts
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+
+  // Move event to the given priority level
+  for (i = 0; i < RSI_SCHEDULER_NUM_PRIORITIES; i++) {
+    scheduler_cb->priority_map[i] &= ~BIT(event_num);
+  }
+  scheduler_cb->priority_map[priority] |= BIT(event_num);
+
+  // Enable all the interrupts
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  return RSI_SUCCESS;
+}
+
 /*====================================================*/
 /**
  * @fn          uint16_t rsi_register_event(uint32_t event_id, void (*event_handler_ptr)(void))
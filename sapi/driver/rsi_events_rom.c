@@ -153,14 +153,16 @@ void ROM_WL_rsi_unmask_event(global_cb_t *global_cb_p, uint32_t event_num)
 ///@private
 uint32_t ROM_WL_rsi_find_event(global_cb_t *global_cb_p, uint32_t event_map)
 {
-  uint8_t i;
+  uint32_t event_no;
 
-  for (i = 0; i < global_cb_p->rsi_max_num_events; i++) {
-    if (event_map & BIT(i)) {
-      break;
-    }
+  if (!event_map) {
+    return global_cb_p->rsi_max_num_events;
   }
-  return i;
+
+  // Lowest set event bit
+  event_no = RSI_EVENT_CTZ(event_map);
+
+  return (event_no < global_cb_p->rsi_max_num_events) ? event_no : global_cb_p->rsi_max_num_events;
 }
 
 /*====================================================*/
@@ -312,39 +312,147 @@ void rsi_wlan_set_nwk_status(int32_t status)
 
 /*==============================================*/
 /**
- * @fn         int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t length, struct rsi_sockaddr *destAddr)
- * @brief      Send data packet
+ * @fn         static uint16_t rsi_driver_send_data_header_len(uint32_t sockID, uint32_t length)
+ * @brief      Get length of send command header placed before the payload in the data packet
+ * @param[in]  sockID - socket descriptor on which data needs to be send
+ * @param[in]  length - data length
+ * @return     Header length
+ *
+ */
+static uint16_t rsi_driver_send_data_header_len(uint32_t sockID, uint32_t length)
+{
+  uint16_t headerLen;
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  if (((rsi_socket_pool[sockID].sock_type >> 4) & 0xF) == AF_INET) {
+    // Calculate header length
+    if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM) {
+      // TCP IPv4 header
+      headerLen = RSI_TCP_FRAME_HEADER_LEN;
+    } else {
+      // UDP IPv4 header
+      headerLen = RSI_UDP_FRAME_HEADER_LEN;
+    }
+  } else {
+    // Calculate header length
+    if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM) {
+      // TCP IPv6 header length
+      headerLen = RSI_TCP_V6_FRAME_HEADER_LEN;
+    } else {
+      // UDP IPv6 header length
+      headerLen = RSI_UDP_V6_FRAME_HEADER_LEN;
+    }
+  }
+
+  // if it is a web socket, setting web socket data header length
+  if (rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_WEBS_SUPPORT) {
+    // If websocket is enabled
+    headerLen += ((length < 126) ? 6 : 8);
+  }
+
+  return headerLen;
+}
+
+/*==============================================*/
+/**
+ * @fn         rsi_pkt_t *rsi_driver_send_data_alloc(uint32_t sockID, uint32_t length, uint8_t **payload)
+ * @brief      Allocate data packet with room for the send command header, so that payload can be
+ *             written directly into the packet
+ * @param[in]  sockID  - socket descriptor on which data needs to be send
+ * @param[in]  length  - maximum data length
+ * @param[out] payload - pointer to payload area of the packet
+ * @return     Allocated packet pointer if Success \n
+ *             NULL - If allocation fails
+ *
+ */
+/// @private
+rsi_pkt_t *rsi_driver_send_data_alloc(uint32_t sockID, uint32_t length, uint8_t **payload)
+{
+  rsi_pkt_t *pkt;
+  uint16_t headerLen;
+
+  // Allocate packet to send data
+  pkt = rsi_pkt_alloc(rsi_wlan_get_data_tx_pool());
+
+  if (pkt == NULL) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_PKT_ALLOCATION_FAILURE, sockID);
+    return NULL;
+  }
+
+  headerLen = rsi_driver_send_data_header_len(sockID, length);
+
+  // Keep payload offset in host descriptor till the packet is sent
+  rsi_uint16_to_2bytes(pkt->desc, headerLen);
+
+  *payload = (pkt->data + headerLen);
+
+  return pkt;
+}
+
+/*==============================================*/
+/**
+ * @fn         rsi_pkt_t *rsi_driver_send_data_alloc_non_blocking(uint32_t sockID, uint32_t length, uint8_t **payload)
+ * @brief      Same as rsi_driver_send_data_alloc(), but does not wait for a packet to be freed, so that it
+ *             can be used from driver task context
+ * @param[in]  sockID  - socket descriptor on which data needs to be send
+ * @param[in]  length  - maximum data length
+ * @param[out] payload - pointer to payload area of the packet
+ * @return     Allocated packet pointer if Success \n
+ *             NULL - If no packet is free, socket status is not changed
+ *
+ */
+/// @private
+rsi_pkt_t *rsi_driver_send_data_alloc_non_blocking(uint32_t sockID, uint32_t length, uint8_t **payload)
+{
+  rsi_pkt_t *pkt;
+  uint16_t headerLen;
+
+  // Allocate packet to send data if one is free
+  pkt = rsi_pkt_alloc_non_blocking(rsi_wlan_get_data_tx_pool());
+
+  if (pkt == NULL) {
+    return NULL;
+  }
+
+  headerLen = rsi_driver_send_data_header_len(sockID, length);
+
+  // Keep payload offset in host descriptor till the packet is sent
+  rsi_uint16_to_2bytes(pkt->desc, headerLen);
+
+  *payload = (pkt->data + headerLen);
+
+  return pkt;
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_driver_queue_pkt(uint32_t sockID, rsi_pkt_t *pkt, uint32_t length, struct rsi_sockaddr *destAddr)
+ * @brief      Fill send command header in a packet allocated using rsi_driver_send_data_alloc() and queue it
+ *             to the module without waiting for it to be written. Packet is freed by the driver in all cases.
  * @param[in]  sockID   - socket descriptor on which data needs to be send
- * @param[in]  buffer   - pointer to data 
- * @param[in]  length   - data length
- * @param[in]  destAddr - pointer to destination socket details 
+ * @param[in]  pkt      - data packet with payload filled
+ * @param[in]  length   - data length, not more than the length packet is allocated for
+ * @param[in]  destAddr - pointer to destination socket details
  * @return     0              - Success \n
  *             Non-Zero Value - Failure
  *
  */
 /// @private
-int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t length, struct rsi_sockaddr *destAddr)
+int32_t rsi_driver_queue_pkt(uint32_t sockID, rsi_pkt_t *pkt, uint32_t length, struct rsi_sockaddr *destAddr)
 {
-  int32_t status = RSI_SUCCESS;
   uint8_t *host_desc;
   uint32_t total_send_size = 0;
   uint16_t headerLen;
+  uint16_t payload_offset;
   rsi_req_socket_send_t *send;
-  rsi_pkt_t *pkt;
   rsi_driver_cb_t *rsi_driver_cb     = global_cb_p->rsi_driver_cb;
   rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
 
-  // Allocate packet to send data
-  pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
-
-  if (pkt == NULL) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_PKT_ALLOCATION_FAILURE, sockID);
-    return RSI_SOCK_ERROR;
-  }
-
   if (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED) {
-    rsi_pkt_free(&rsi_driver_cb->wlan_cb->wlan_tx_pool, pkt);
+    // Drop external payload attached to the packet, if any
+    rsi_pkt_detach_payload(pkt, NULL);
+    rsi_pkt_free(rsi_wlan_get_data_tx_pool(), pkt);
     // Set error
     rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
     return RSI_SOCK_ERROR;
@@ -356,6 +464,16 @@ int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t
   // Get host descriptor pointer
   host_desc = pkt->desc;
 
+  // Get payload offset the packet is allocated with
+  payload_offset = rsi_bytes2R_to_uint16(host_desc);
+
+  headerLen = rsi_driver_send_data_header_len(sockID, length);
+
+  // Websocket header shrinks if less data is sent than allocated for
+  if (headerLen != payload_offset) {
+    memmove(pkt->data + headerLen, pkt->data + payload_offset, length);
+  }
+
   // Memset host descriptor
   memset(host_desc, 0, RSI_HOST_DESC_LENGTH);
 
@@ -373,15 +491,6 @@ int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t
 
     // Fill destination port
     rsi_uint16_to_2bytes(send->dest_port, ntohs(((struct rsi_sockaddr_in *)destAddr)->sin_port));
-
-    // Calculate header length
-    if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM) {
-      // TCP IPv4 header
-      headerLen = RSI_TCP_FRAME_HEADER_LEN;
-    } else {
-      // UDP IPv4 header
-      headerLen = RSI_UDP_FRAME_HEADER_LEN;
-    }
   } else {
     // Fill IP version as 6
     rsi_uint16_to_2bytes(send->ip_version, 6);
@@ -393,21 +502,6 @@ int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t
 
     // Fill destination port
     rsi_uint16_to_2bytes(send->dest_port, ntohs(((struct rsi_sockaddr_in6 *)destAddr)->sin6_port));
-
-    // Calculate header length
-    if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM) {
-      // TCP IPv6 header length
-      headerLen = RSI_TCP_V6_FRAME_HEADER_LEN;
-    } else {
-      // UDP IPv6 header length
-      headerLen = RSI_UDP_V6_FRAME_HEADER_LEN;
-    }
-  }
-
-  // if it is a web socket, setting web socket data header length
-  if (rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_WEBS_SUPPORT) {
-    // If websocket is enabled
-    headerLen += ((length < 126) ? 6 : 8);
   }
 
   // Fill socket desriptor
@@ -425,29 +519,57 @@ int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t
   // Total send length includes header length and payload length
   total_send_size = (headerLen + length);
 
-  headerLen -= (sizeof(rsi_req_socket_send_t) - sizeof(send->send_buffer));
-
-  // Copy data to be sent
-  memcpy(&send->send_buffer[headerLen], buffer, length);
-
   // Fill host descriptor
   rsi_uint16_to_2bytes(host_desc, (total_send_size & 0xFFF));
 
   // Fill packet type
   host_desc[1] |= (RSI_WLAN_DATA_Q << 4);
 
+  rsi_socket_stats_tx_queued(sockID, length);
+
   // Enqueue packet to WLAN TX queue
   rsi_enqueue_pkt(&rsi_driver_cb->wlan_tx_q, pkt);
 
   // Set TX packet pending event
   rsi_set_event(RSI_TX_EVENT);
 
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_driver_send_pkt(uint32_t sockID, rsi_pkt_t *pkt, uint32_t length, struct rsi_sockaddr *destAddr)
+ * @brief      Fill send command header in a packet allocated using rsi_driver_send_data_alloc() and send it.
+ *             Packet is freed by the driver in all cases.
+ * @param[in]  sockID   - socket descriptor on which data needs to be send
+ * @param[in]  pkt      - data packet with payload filled
+ * @param[in]  length   - data length, not more than the length packet is allocated for
+ * @param[in]  destAddr - pointer to destination socket details
+ * @return     0              - Success \n
+ *             Non-Zero Value - Failure
+ *
+ */
+/// @private
+int32_t rsi_driver_send_pkt(uint32_t sockID, rsi_pkt_t *pkt, uint32_t length, struct rsi_sockaddr *destAddr)
+{
+  int32_t status = RSI_SUCCESS;
+#ifndef RSI_UART_INTERFACE
+  uint32_t wait_start;
+#endif
+
+  status = rsi_driver_queue_pkt(sockID, pkt, length, destAddr);
+  if (status != RSI_SUCCESS) {
+    return status;
+  }
+
 #ifdef RSI_UART_INTERFACE
 #ifndef RSI_SEND_SEM_BITMAP
   rsi_driver_cb_non_rom->send_wait_bitmap |= BIT(0);
 #endif
   if (rsi_wait_on_socket_semaphore(&rsi_driver_cb_non_rom->send_data_sem, RSI_SEND_DATA_RESPONSE_WAIT_TIME)
       != RSI_ERROR_NONE) {
+    // Packet may still be queued, it must not refer to the user buffer any more
+    rsi_pkt_release_payload(pkt);
     rsi_wlan_socket_set_status(RSI_ERROR_RESPONSE_TIMEOUT, sockID);
 
     return RSI_SOCK_ERROR;
@@ -456,9 +578,13 @@ int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t
 #ifndef RSI_SOCK_SEM_BITMAP
   rsi_socket_pool_non_rom[sockID].socket_wait_bitmap |= BIT(2);
 #endif
+  wait_start = rsi_hal_gettickcount();
   status =
     rsi_wait_on_socket_semaphore(&rsi_socket_pool_non_rom[sockID].sock_send_sem, RSI_SEND_DATA_RESPONSE_WAIT_TIME);
+  rsi_socket_stats_wait_done(sockID, wait_start);
   if (status != RSI_ERROR_NONE) {
+    // Packet may still be queued, it must not refer to the user buffer any more
+    rsi_pkt_release_payload(pkt);
     // get wlan/network command response status
     rsi_wlan_socket_set_status(status, sockID);
     return RSI_SOCK_ERROR;
@@ -470,13 +596,52 @@ int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t
   // Return status
   return status;
 }
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t length, struct rsi_sockaddr *destAddr)
+ * @brief      Send data packet
+ * @param[in]  sockID   - socket descriptor on which data needs to be send
+ * @param[in]  buffer   - pointer to data 
+ * @param[in]  length   - data length
+ * @param[in]  destAddr - pointer to destination socket details 
+ * @return     0              - Success \n
+ *             Non-Zero Value - Failure
+ *
+ */
+/// @private
+int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t length, struct rsi_sockaddr *destAddr)
+{
+  rsi_pkt_t *pkt;
+  uint8_t *payload;
+
+  // Allocate packet to send data
+  pkt = rsi_driver_send_data_alloc(sockID, length, &payload);
+
+  if (pkt == NULL) {
+    return RSI_SOCK_ERROR;
+  }
+
+#if RSI_TX_GATHER_MIN_LEN
+  // Send waits till the packet is written to the module, so large payloads are written from
+  // the user buffer after the send command header instead of being copied into the packet
+  if ((length < RSI_TX_GATHER_MIN_LEN) || (rsi_pkt_attach_payload(pkt, buffer, (uint16_t)length) != RSI_SUCCESS))
+#endif
+  {
+    // Copy data to be sent
+    memcpy(payload, buffer, length);
+  }
+
+  return rsi_driver_send_pkt(sockID, pkt, length, destAddr);
+}
 /*==============================================*/
 /**
  * @fn         int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt)
  * @brief      Process data receive packet. 
  * @param[in]  pkt - pointer to data packet  
- * @return     0              - Success \n
- *             Non-Zero Value - Failure
+ * @return     0                 - Success \n
+ *             RSI_RX_PKT_LOANED - Success, packet is loaned to application and must not be freed \n
+ *             Negative Value    - Failure
  */
 
 int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt)
@@ -533,7 +698,28 @@ int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt)
     // Get actual data offset
     data_offset = rsi_bytes2R_to_uint16(recv->offset);
 
+    rsi_socket_stats_rx_arrival(sockID, data_length);
+
     if (!(sock_info->sock_bitmap & RSI_SOCKET_FEAT_SYNCHRONOUS)) {
+      // Data is handed to application right away
+      rsi_socket_stats_rx_delivered(sockID);
+      // Readiness reported by an earlier select is consumed by this data
+      rsi_socket_pool_non_rom[sockID].ready_to_read = 0;
+#if !((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
+      // One RX packet is always kept back from loan, so that command responses can still be received.
+      // Data received while the rest are on loan goes to the socket receive callback instead.
+      if ((rsi_socket_pool_non_rom[sockID].recv_pkt_handler != NULL) && rsi_rx_loan_take()) {
+        // Hand over packet to application, it is returned using rsi_recv_pkt_release()
+        if ((sock_info->sock_bitmap & RSI_SOCKET_FEAT_WEBS_SUPPORT)) {
+          *((uint8_t *)recv + data_offset - 1) = websocket_info;
+          rsi_socket_pool_non_rom[sockID].recv_pkt_handler(sockID, pkt, data_offset - 1, data_length + 1);
+        } else {
+          rsi_socket_pool_non_rom[sockID].recv_pkt_handler(sockID, pkt, data_offset, data_length);
+        }
+        rsi_epoll_notify(sockID, RSI_EPOLLIN);
+        return RSI_RX_PKT_LOANED;
+      }
+#endif
 
       if (sock_info->sock_receive_callback != NULL) {
         if ((sock_info->sock_bitmap & RSI_SOCKET_FEAT_WEBS_SUPPORT)) {
@@ -546,10 +732,18 @@ int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt)
           sock_info->sock_receive_callback(sockID, ((uint8_t *)recv + data_offset), data_length);
         }
       }
+      rsi_epoll_notify(sockID, RSI_EPOLLIN);
       return RSI_SUCCESS;
     }
 
+#if RSI_SOCKET_RX_RING_SIZE
+    if (rsi_socket_rx_ring_used(sockID)) {
+      // Buffer data in socket receive ring, rsi_recv() is served from it
+      rsi_socket_rx_ring_write(sockID, ((uint8_t *)recv + data_offset), data_length);
+    } else if (global_cb_p->rx_buffer_mem_copy == 1) {
+#else
     if (global_cb_p->rx_buffer_mem_copy == 1) {
+#endif
       // If socket receive available length is still present
       if (sock_info->sock_recv_available_length != 0) {
         return RSI_SOCK_ERROR;
@@ -565,18 +759,20 @@ int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt)
 #ifdef RSI_PROCESS_MAX_RX_DATA
         if (sock_info->sock_type & SOCK_STREAM) {
           // Memcopy to socket receive buffer
-          memcpy((sock_info->recv_buffer + sock_info->recv_buffer_length),
-                 ((uint8_t *)recv + data_offset),
-                 data_length);
+          rsi_socket_recv_copy(sockID,
+                               sock_info->recv_buffer,
+                               sock_info->recv_buffer_length,
+                               ((uint8_t *)recv + data_offset),
+                               data_length);
           sock_info->recv_buffer_length += data_length;
         } else {
           // Memcopy to socket receive buffer
-          memcpy(sock_info->recv_buffer, ((uint8_t *)recv + data_offset), data_length);
+          rsi_socket_recv_copy(sockID, sock_info->recv_buffer, 0, ((uint8_t *)recv + data_offset), data_length);
           sock_info->recv_buffer_length = data_length;
         }
 #else
         // Memcopy to socket receive buffer
-        memcpy(sock_info->recv_buffer, ((uint8_t *)recv + data_offset), data_length);
+        rsi_socket_recv_copy(sockID, sock_info->recv_buffer, 0, ((uint8_t *)recv + data_offset), data_length);
         sock_info->recv_buffer_length = data_length;
 #endif
       } else {
@@ -614,6 +810,63 @@ int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt)
   }
   return RSI_SUCCESS;
 }
+/*==============================================*/
+/**
+ * @fn         uint8_t rsi_rx_loan_take(void)
+ * @brief      Account a received packet loaned to application, unless all RX packets but one are on loan already.
+ *             The one kept back is used to receive command responses, which application may be waiting for
+ *             before it releases loaned packets.
+ * @param[in]  void
+ * @return     1 - Packet can be loaned \n
+ *             0 - Packet must not be loaned
+ */
+/// @private
+uint8_t rsi_rx_loan_take(void)
+{
+  rsi_driver_cb_t *rsi_driver_cb = global_cb_p->rsi_driver_cb;
+  rsi_reg_flags_t flags;
+  uint8_t loaned = 0;
+
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  if ((rsi_driver_cb_non_rom->rx_loan_count + 1) < rsi_driver_cb->rx_pool.size) {
+    rsi_driver_cb_non_rom->rx_loan_count++;
+    loaned = 1;
+  }
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  return loaned;
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_recv_pkt_release(rsi_pkt_t *pkt)
+ * @brief      Return a received data packet handed over to a socket receive packet handler. This is a non-blocking API.
+ * @param[in]  pkt - packet given to the receive packet handler
+ * @return     0              - Success \n
+ *             Negative Value - Failure
+ */
+int32_t rsi_recv_pkt_release(rsi_pkt_t *pkt)
+{
+  int32_t status;
+  rsi_reg_flags_t flags;
+  rsi_driver_cb_t *rsi_driver_cb = global_cb_p->rsi_driver_cb;
+
+  if ((pkt == NULL) || (rsi_driver_cb_non_rom->rx_loan_count == 0)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  status = rsi_pkt_free(&rsi_driver_cb->rx_pool, pkt);
+  if (status != RSI_SUCCESS) {
+    return status;
+  }
+
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  rsi_driver_cb_non_rom->rx_loan_count--;
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  return RSI_SUCCESS;
+}
+
 /*==============================================*/
 /**
  * @fn          void rsi_post_waiting_nwk_semaphore()
@@ -22,6 +22,177 @@
 /** @addtogroup DRIVER5
 * @{
 */
+/*==============================================*/
+/**
+ * @fn         static uint16_t rsi_pkt_lock_free_avail(rsi_pkt_pool_t *pool_cb)
+ * @brief      Return number of packets in a lock free packet pool ring
+ * @param[in]  pool_cb - packet pool pointer
+ * @return     Number of packets in pool
+ *
+ */
+static uint16_t rsi_pkt_lock_free_avail(rsi_pkt_pool_t *pool_cb)
+{
+  uint16_t head = pool_cb->ring_head;
+  uint16_t tail = pool_cb->ring_tail;
+
+  // Ring has size + 1 slots with one slot always left empty
+  return (head >= tail) ? (head - tail) : (head + pool_cb->size + 1 - tail);
+}
+
+/*==============================================*/
+/**
+ * @fn         static rsi_pkt_t *rsi_pkt_lock_free_alloc(rsi_pkt_pool_t *pool_cb, uint8_t wait)
+ * @brief      Allocate packet from a lock free packet pool, only one task may allocate from the pool.
+ *             Semaphore is used only when the pool is empty.
+ * @param[in]  pool_cb - packet pool pointer
+ * @param[in]  wait    - 1 to wait for a packet if the pool is empty, 0 to fail right away
+ * @return     Allocated packet pointer if Success \n
+ *             NULL - If allocation fails
+ *
+ */
+static rsi_pkt_t *rsi_pkt_lock_free_alloc(rsi_pkt_pool_t *pool_cb, uint8_t wait)
+{
+  rsi_pkt_t *pkt;
+  uint16_t tail = pool_cb->ring_tail;
+
+  while (tail == pool_cb->ring_head) {
+    if (!wait) {
+      return NULL;
+    }
+    // Ask next free to signal semaphore, and check again so that a free racing with this is not missed
+    pool_cb->ring_waiting = 1;
+    RSI_PKT_POOL_MEMORY_BARRIER();
+    if (tail != pool_cb->ring_head) {
+      pool_cb->ring_waiting = 0;
+      break;
+    }
+    if (RSI_SEMAPHORE_WAIT(&pool_cb->pkt_sem, RSI_PKT_ALLOC_RESPONSE_WAIT_TIME) != RSI_ERROR_NONE) {
+      pool_cb->ring_waiting = 0;
+      return NULL;
+    }
+  }
+
+  // Read slot only after head index shows it is filled
+  RSI_PKT_POOL_MEMORY_BARRIER();
+  pkt       = (rsi_pkt_t *)(pool_cb->pool[tail]);
+  pkt->next = NULL;
+
+  // Hand slot back to producer
+  RSI_PKT_POOL_MEMORY_BARRIER();
+  pool_cb->ring_tail = (tail == pool_cb->size) ? 0 : (tail + 1);
+
+  return pkt;
+}
+
+/*==============================================*/
+/**
+ * @fn         static int32_t rsi_pkt_lock_free_free(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt, uint8_t from_isr)
+ * @brief      Free packet to a lock free packet pool, only one task or ISR may free to the pool
+ * @param[in]  pool_cb  - packet pool pointer
+ * @param[in]  pkt      - packet pointer which needs to be freed
+ * @param[in]  from_isr - 1 if called from interrupt context
+ * @return     0              - Success \n
+ *             Negative Value - Failure
+ *
+ */
+static int32_t rsi_pkt_lock_free_free(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt, uint8_t from_isr)
+{
+  uint16_t head = pool_cb->ring_head;
+  uint16_t next = (head == pool_cb->size) ? 0 : (head + 1);
+
+  if (next == pool_cb->ring_tail) {
+    // If pool is already full then return an error
+    return -1;
+  }
+
+  // Fill slot before publishing it through head index
+  pool_cb->pool[head] = pkt;
+  RSI_PKT_POOL_MEMORY_BARRIER();
+  pool_cb->ring_head = next;
+
+  // Wake up allocator only if it is blocked on empty pool
+  RSI_PKT_POOL_MEMORY_BARRIER();
+  if (pool_cb->ring_waiting) {
+    pool_cb->ring_waiting = 0;
+    if (from_isr) {
+      RSI_SEMAPHORE_POST_FROM_ISR(&pool_cb->pkt_sem);
+    } else {
+      RSI_SEMAPHORE_POST(&pool_cb->pkt_sem);
+    }
+  }
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @fn         static void rsi_pkt_pool_check_watermark(rsi_pkt_pool_t *pool_cb)
+ * @brief      Report low/high watermark crossing of a packet pool to its watermark callback
+ * @param[in]  pool_cb - packet pool pointer
+ * @return     void
+ *
+ */
+static void rsi_pkt_pool_check_watermark(rsi_pkt_pool_t *pool_cb)
+{
+  rsi_reg_flags_t flags;
+  uint16_t avail;
+  uint8_t event = 0;
+
+  if (pool_cb->watermark_cb == NULL) {
+    return;
+  }
+
+  // Disable interrupts
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+
+  avail = pool_cb->lock_free ? rsi_pkt_lock_free_avail(pool_cb) : pool_cb->avail;
+  if (!pool_cb->low_watermark_hit && (avail <= pool_cb->low_watermark)) {
+    pool_cb->low_watermark_hit = 1;
+    event                      = RSI_PKT_POOL_LOW_WATERMARK;
+  } else if (pool_cb->low_watermark_hit && (avail >= pool_cb->high_watermark)) {
+    pool_cb->low_watermark_hit = 0;
+    event                      = RSI_PKT_POOL_HIGH_WATERMARK;
+  }
+
+  // Restore interrupts
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  if (event) {
+    pool_cb->watermark_cb(pool_cb, event, avail);
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_pkt_pool_set_watermarks(rsi_pkt_pool_t *pool_cb, uint16_t low_watermark,
+ *                                                 uint16_t high_watermark,
+ *                                                 void (*watermark_cb)(rsi_pkt_pool_t *pool_cb, uint8_t event, uint16_t avail))
+ * @brief      Register low/high watermark callback on a packet pool. Callback is called with
+ *             RSI_PKT_POOL_LOW_WATERMARK once available packets drop to low_watermark and with
+ *             RSI_PKT_POOL_HIGH_WATERMARK once they recover to high_watermark.
+ * @param[in]  pool_cb        - packet pool pointer \n
+ * @param[in]  low_watermark  - available packet count to report low watermark at \n
+ * @param[in]  high_watermark - available packet count to report high watermark at, must be above low_watermark \n
+ * @param[in]  watermark_cb   - callback, NULL to stop watermark reporting \n
+ * @return     0              - Success \n
+ *             Negative Value - Failure
+ *
+ */
+int32_t rsi_pkt_pool_set_watermarks(rsi_pkt_pool_t *pool_cb,
+                                    uint16_t low_watermark,
+                                    uint16_t high_watermark,
+                                    void (*watermark_cb)(rsi_pkt_pool_t *pool_cb, uint8_t event, uint16_t avail))
+{
+  if ((pool_cb == NULL) || ((watermark_cb != NULL) && (high_watermark <= low_watermark))) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  pool_cb->watermark_cb      = NULL;
+  pool_cb->low_watermark     = low_watermark;
+  pool_cb->high_watermark    = high_watermark;
+  pool_cb->low_watermark_hit = 0;
+  pool_cb->watermark_cb      = watermark_cb;
+  return RSI_SUCCESS;
+}
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_pkt_pool_init(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t total_size, uint32_t pkt_size)
@@ -44,6 +215,37 @@ int32_t rsi_pkt_pool_init(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t tot
 #endif
 }
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_pkt_pool_init_lock_free(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t total_size, uint32_t pkt_size)
+ * @brief      Initialize/create lock free packet pool from the provided buffer. Allocation and free of this
+ *             pool do not disable interrupts, so the pool must have a single allocating context and a single
+ *             freeing context (for example application task allocates and driver task or an ISR frees).
+ * @param[in]  pool_cb    - packet pool pointer which needs to be initialized  \n
+ * @param[in]  buffer     - buffer pointer to create pool \n
+ * @param[in]  total_size - size of pool to create \n
+ * @param[in]  pkt_size   - size of each packet in pool \n
+ * @return     0              - Success \n
+ *             Negative Value - Failure
+ *
+ */
+int32_t rsi_pkt_pool_init_lock_free(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t total_size, uint32_t pkt_size)
+{
+  int32_t status;
+
+  status = rsi_pkt_pool_init(pool_cb, buffer, total_size, pkt_size);
+  if (status != RSI_SUCCESS) {
+    return status;
+  }
+
+  // Pool array holds packets at index 1 to size, use it as a ring of size + 1 slots starting at index 1
+  pool_cb->ring_tail = 1;
+  pool_cb->ring_head = 0;
+  pool_cb->lock_free = 1;
+
+  return RSI_SUCCESS;
+}
+
 /*==============================================*/
 /**
  * @fn          rsi_pkt_t *rsi_pkt_alloc(rsi_pkt_pool_t *pool_cb)
@@ -56,11 +258,69 @@ int32_t rsi_pkt_pool_init(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t tot
 ///@private
 rsi_pkt_t *rsi_pkt_alloc(rsi_pkt_pool_t *pool_cb)
 {
+  rsi_pkt_t *pkt;
+  if (pool_cb->lock_free) {
+    pkt = rsi_pkt_lock_free_alloc(pool_cb, 1);
+  } else {
 #ifdef ROM_WIRELESS
-  return ROMAPI_WL->rsi_pkt_alloc(global_cb_p, pool_cb);
+    pkt = ROMAPI_WL->rsi_pkt_alloc(global_cb_p, pool_cb);
 #else
-  return api_wl->rsi_pkt_alloc(global_cb_p, pool_cb);
+    pkt = api_wl->rsi_pkt_alloc(global_cb_p, pool_cb);
 #endif
+  }
+  rsi_pkt_pool_check_watermark(pool_cb);
+  return pkt;
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_pkt_t *rsi_pkt_alloc_non_blocking(rsi_pkt_pool_t *pool_cb)
+ * @brief       Allocate packet from a given packet pool without waiting for a packet to be freed, so that it
+ *              can be used from driver task context. Semaphore of the pool is kept in step with
+ *              \ref rsi_pkt_alloc(); it is waited on for RSI_PKT_ALLOC_NON_BLOCKING_WAIT_TIME at most, and
+ *              only while the pool has packets, to let an allocation in progress in another task finish.
+ * @param[in]   pool_cb - packet pool pointer from which packet needs to be allocated
+ * @return      Allocated packet pointer if Success \n
+ *              NULL - If pool is empty
+ *
+ */
+///@private
+rsi_pkt_t *rsi_pkt_alloc_non_blocking(rsi_pkt_pool_t *pool_cb)
+{
+  rsi_reg_flags_t flags;
+  rsi_pkt_t *pkt    = NULL;
+  uint8_t more_pkts = 0;
+
+  if (pool_cb->lock_free) {
+    pkt = rsi_pkt_lock_free_alloc(pool_cb, 0);
+    rsi_pkt_pool_check_watermark(pool_cb);
+    return pkt;
+  }
+
+  // Semaphore is signalled while pool has packets, nothing to wait for if it is empty
+  if (rsi_is_pkt_available(pool_cb) == 0) {
+    return NULL;
+  }
+  if (RSI_SEMAPHORE_WAIT(&pool_cb->pkt_sem, RSI_PKT_ALLOC_NON_BLOCKING_WAIT_TIME) != RSI_ERROR_NONE) {
+    return NULL;
+  }
+
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  // Allocation in another task may have taken the last packet
+  if (pool_cb->avail != 0) {
+    pkt       = (rsi_pkt_t *)(pool_cb->pool[pool_cb->avail]);
+    pkt->next = NULL;
+    pool_cb->avail--;
+    // Keep semaphore signalled for next allocation if more packets are left
+    more_pkts = (pool_cb->avail != 0);
+  }
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  if (more_pkts) {
+    RSI_SEMAPHORE_POST(&pool_cb->pkt_sem);
+  }
+  rsi_pkt_pool_check_watermark(pool_cb);
+  return pkt;
 }
 
 /*==============================================*/
@@ -76,11 +336,38 @@ rsi_pkt_t *rsi_pkt_alloc(rsi_pkt_pool_t *pool_cb)
 ///@private
 int32_t rsi_pkt_free(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt)
 {
+  int32_t status;
+  if (pool_cb->lock_free) {
+    status = rsi_pkt_lock_free_free(pool_cb, pkt, 0);
+  } else {
 #ifdef ROM_WIRELESS
-  return ROMAPI_WL->rsi_pkt_free(global_cb_p, pool_cb, pkt);
+    status = ROMAPI_WL->rsi_pkt_free(global_cb_p, pool_cb, pkt);
 #else
-  return api_wl->rsi_pkt_free(global_cb_p, pool_cb, pkt);
+    status = api_wl->rsi_pkt_free(global_cb_p, pool_cb, pkt);
 #endif
+  }
+  rsi_pkt_pool_check_watermark(pool_cb);
+  return status;
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_pkt_free_from_isr(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt)
+ * @brief      Free the packet from interrupt context. Supported only for lock free packet pools,
+ *             where the ISR is the only context freeing to the pool.
+ * @param[in]  pool_cb - packet pool to which packet needs to be freed
+ * @param[in]  pkt     - packet pointer which needs to be freed
+ * @return     0              - Success \n
+ *             Non-Zero Value - Failure
+ *
+ */
+int32_t rsi_pkt_free_from_isr(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt)
+{
+  if (!pool_cb->lock_free) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  // Watermark callbacks are not reported from interrupt context
+  return rsi_pkt_lock_free_free(pool_cb, pkt, 1);
 }
 
 /*==============================================*/
@@ -94,10 +381,185 @@ int32_t rsi_pkt_free(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt)
 ///@private
 uint32_t rsi_is_pkt_available(rsi_pkt_pool_t *pool_cb)
 {
+  if (pool_cb->lock_free) {
+    return rsi_pkt_lock_free_avail(pool_cb);
+  }
 #ifdef ROM_WIRELESS
   return ROMAPI_WL->rsi_is_pkt_available(global_cb_p, pool_cb);
 #else
   return api_wl->rsi_is_pkt_available(global_cb_p, pool_cb);
 #endif
 }
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_pkt_attach_payload(rsi_pkt_t *pkt, uint8_t *buffer, uint16_t length)
+ * @brief      Attach an external payload to a TX packet. The driver writes it to the module right
+ *             after the packet using scatter-gather frame write, so it must not be copied into the
+ *             packet. Frame length in the host descriptor must include the external payload length.
+ *             Buffer must stay valid till the packet is written to the module.
+ * @param[in]  pkt    - TX packet
+ * @param[in]  buffer - external payload
+ * @param[in]  length - external payload length
+ * @return     0              - Success \n
+ *             Non-Zero Value - Failure, no free entry to attach the payload
+ *
+ */
+///@private
+int32_t rsi_pkt_attach_payload(rsi_pkt_t *pkt, uint8_t *buffer, uint16_t length)
+{
+  rsi_reg_flags_t flags;
+  uint8_t i;
+  int32_t status = RSI_ERROR_PKT_ALLOCATION_FAILURE;
+
+  flags = rsi_critical_section_entry();
+  for (i = 0; i < RSI_TX_GATHER_MAX; i++) {
+    if (rsi_driver_cb_non_rom->tx_gather[i].pkt == NULL) {
+      rsi_driver_cb_non_rom->tx_gather[i].pkt            = pkt;
+      rsi_driver_cb_non_rom->tx_gather[i].payload.buffer = buffer;
+      rsi_driver_cb_non_rom->tx_gather[i].payload.length = length;
+      rsi_driver_cb_non_rom->tx_gather_count++;
+      status = RSI_SUCCESS;
+      break;
+    }
+  }
+  rsi_critical_section_exit(flags);
+
+  return status;
+}
+
+/*==============================================*/
+/**
+ * @fn         uint8_t rsi_pkt_detach_payload(rsi_pkt_t *pkt, rsi_frame_iovec_t *iov)
+ * @brief      Detach the external payload attached to a TX packet, if any
+ * @param[in]  pkt - TX packet
+ * @param[out] iov - external payload segment, valid only if 1 is returned, can be NULL. If given, caller writes
+ *                   the payload to the module and calls rsi_pkt_payload_written() once done.
+ * @return     1 - Payload was attached to the packet \n
+ *             0 - No payload attached
+ *
+ */
+///@private
+uint8_t rsi_pkt_detach_payload(rsi_pkt_t *pkt, rsi_frame_iovec_t *iov)
+{
+  rsi_reg_flags_t flags;
+  uint8_t i;
+  uint8_t found = 0;
+
+  // Most packets are sent without external payload
+  if (rsi_driver_cb_non_rom->tx_gather_count == 0) {
+    return 0;
+  }
+
+  flags = rsi_critical_section_entry();
+  for (i = 0; i < RSI_TX_GATHER_MAX; i++) {
+    if (rsi_driver_cb_non_rom->tx_gather[i].pkt == pkt) {
+      if (rsi_driver_cb_non_rom->tx_gather[i].copying) {
+        // Payload is being copied into the packet by a timed out send, which then drops the entry
+        rsi_driver_cb_non_rom->tx_gather_waiting = pkt;
+        rsi_critical_section_exit(flags);
+        rsi_semaphore_wait(&rsi_driver_cb_non_rom->tx_gather_sem, 0);
+        return 0;
+      }
+      if (iov != NULL) {
+        *iov                                     = rsi_driver_cb_non_rom->tx_gather[i].payload;
+        rsi_driver_cb_non_rom->tx_gather_writing = pkt;
+      }
+      rsi_driver_cb_non_rom->tx_gather[i].pkt = NULL;
+      rsi_driver_cb_non_rom->tx_gather_count--;
+      found = 1;
+      break;
+    }
+  }
+  rsi_critical_section_exit(flags);
+
+  return found;
+}
+
+/*==============================================*/
+/**
+ * @fn         void rsi_pkt_release_payload(rsi_pkt_t *pkt)
+ * @brief      Stop using the buffer of the external payload attached to a queued TX packet, so that it can be
+ *             reused by its owner while the packet is still queued. Payload not yet taken by the driver is copied
+ *             into the packet, otherwise this waits till the driver has written it to the module.
+ * @param[in]  pkt - TX packet, with room for the external payload
+ * @return     void
+ *
+ */
+///@private
+void rsi_pkt_release_payload(rsi_pkt_t *pkt)
+{
+  rsi_reg_flags_t flags;
+  rsi_tx_gather_t *entry = NULL;
+  uint8_t i;
+  uint8_t wait = 0;
+  uint8_t post = 0;
+  uint16_t length;
+
+  flags = rsi_critical_section_entry();
+  for (i = 0; (i < RSI_TX_GATHER_MAX) && rsi_driver_cb_non_rom->tx_gather_count; i++) {
+    if (rsi_driver_cb_non_rom->tx_gather[i].pkt == pkt) {
+      // Driver task does not take the packet till the copy is done
+      entry          = &rsi_driver_cb_non_rom->tx_gather[i];
+      entry->copying = 1;
+      break;
+    }
+  }
+  if ((entry == NULL) && (rsi_driver_cb_non_rom->tx_gather_writing == pkt)) {
+    // Driver task writes the payload from the buffer, so it must be done with it
+    rsi_driver_cb_non_rom->tx_gather_waiting = pkt;
+    wait                                     = 1;
+  }
+  rsi_critical_section_exit(flags);
+
+  if (entry != NULL) {
+    // External payload follows the payload in the packet, as it is written to the module
+    length = (rsi_bytes2R_to_uint16(pkt->desc) & 0xFFF);
+    memcpy(&pkt->data[length - entry->payload.length], entry->payload.buffer, entry->payload.length);
+
+    flags          = rsi_critical_section_entry();
+    entry->pkt     = NULL;
+    entry->copying = 0;
+    rsi_driver_cb_non_rom->tx_gather_count--;
+    if (rsi_driver_cb_non_rom->tx_gather_waiting == pkt) {
+      rsi_driver_cb_non_rom->tx_gather_waiting = NULL;
+      post                                     = 1;
+    }
+    rsi_critical_section_exit(flags);
+
+    if (post) {
+      rsi_semaphore_post(&rsi_driver_cb_non_rom->tx_gather_sem);
+    }
+  } else if (wait) {
+    rsi_semaphore_wait(&rsi_driver_cb_non_rom->tx_gather_sem, 0);
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn         void rsi_pkt_payload_written(rsi_pkt_t *pkt)
+ * @brief      Called by driver task once the external payload detached from a TX packet is written to the module
+ * @param[in]  pkt - TX packet
+ * @return     void
+ *
+ */
+///@private
+void rsi_pkt_payload_written(rsi_pkt_t *pkt)
+{
+  rsi_reg_flags_t flags;
+  uint8_t post = 0;
+
+  flags                                    = rsi_critical_section_entry();
+  rsi_driver_cb_non_rom->tx_gather_writing = NULL;
+  if (rsi_driver_cb_non_rom->tx_gather_waiting == pkt) {
+    // Timed out send is waiting to reuse the buffer
+    rsi_driver_cb_non_rom->tx_gather_waiting = NULL;
+    post                                     = 1;
+  }
+  rsi_critical_section_exit(flags);
+
+  if (post) {
+    rsi_semaphore_post(&rsi_driver_cb_non_rom->tx_gather_sem);
+  }
+}
 /** @} */
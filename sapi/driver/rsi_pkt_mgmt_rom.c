@@ -212,7 +212,8 @@ rsi_pkt_t *ROM_WL_rsi_pkt_alloc(global_cb_t *global_cb_p, rsi_pkt_pool_t *pool_c
   //This statement is added only to resolve compilation warning, value is unchanged
   UNUSED_PARAMETER(global_cb_p);
   rsi_reg_flags_t flags;
-  rsi_pkt_t *pkt = NULL;
+  rsi_pkt_t *pkt    = NULL;
+  uint8_t more_pkts = 0;
 
   // Wait on wlan semaphore
   if (RSI_SEMAPHORE_WAIT(&pool_cb->pkt_sem, RSI_PKT_ALLOC_RESPONSE_WAIT_TIME) != RSI_ERROR_NONE) {
@@ -236,12 +237,19 @@ rsi_pkt_t *ROM_WL_rsi_pkt_alloc(global_cb_t *global_cb_p, rsi_pkt_pool_t *pool_c
   // Decrease available count
   pool_cb->avail--;
 
+  // Keep semaphore signalled for next allocation if more packets are left
+  more_pkts = (pool_cb->avail != 0);
+
   // initialize next with NULL
   pkt->next = NULL;
 
   // Retore interrupts
   RSI_CRITICAL_SECTION_EXIT(flags);
 
+  if (more_pkts) {
+    RSI_SEMAPHORE_POST(&pool_cb->pkt_sem);
+  }
+
   // Return pakcet pointer
   return pkt;
 }
@@ -262,6 +270,7 @@ int32_t ROM_WL_rsi_pkt_free(global_cb_t *global_cb_p, rsi_pkt_pool_t *pool_cb, r
   //This statement is added only to resolve compilation warning, value is unchanged
   UNUSED_PARAMETER(global_cb_p);
   rsi_reg_flags_t flags;
+  uint8_t was_empty;
 
   // Disable interrupts
   flags = RSI_CRITICAL_SECTION_ENTRY();
@@ -274,6 +283,9 @@ int32_t ROM_WL_rsi_pkt_free(global_cb_t *global_cb_p, rsi_pkt_pool_t *pool_cb, r
     return -1;
   }
 
+  // Semaphore is left signalled by alloc while packets remain, so post only when pool was empty
+  was_empty = (pool_cb->avail == 0);
+
   // Increase pool available count
   pool_cb->avail++;
 
@@ -283,8 +295,10 @@ int32_t ROM_WL_rsi_pkt_free(global_cb_t *global_cb_p, rsi_pkt_pool_t *pool_cb, r
   // Retore interrupts
   RSI_CRITICAL_SECTION_EXIT(flags);
 
-  // Release mutex lock
-  RSI_SEMAPHORE_POST(&pool_cb->pkt_sem);
+  if (was_empty) {
+    // Release mutex lock
+    RSI_SEMAPHORE_POST(&pool_cb->pkt_sem);
+  }
 
   return RSI_SUCCESS;
 }
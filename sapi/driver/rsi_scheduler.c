@@ -83,6 +83,51 @@ void rsi_scheduler(rsi_scheduler_cb_t *scheduler_cb)
   api_wl->rsi_scheduler(global_cb_p, scheduler_cb);
 #endif
 }
+/*====================================================*/
+/**
+ * @fn          void rsi_scheduler_dispatch(rsi_scheduler_cb_t *scheduler_cb, uint32_t event_map)
+ * @brief       Call handlers of all events in a pending event snapshot, highest priority first
+ * @param[in]   scheduler_cb - pointer to scheduler cb structure
+ * @param[in]   event_map    - pending events after applying mask
+ * @return      void
+ */
+/// @private
+void rsi_scheduler_dispatch(rsi_scheduler_cb_t *scheduler_cb, uint32_t event_map)
+{
+  uint32_t event_no;
+  uint32_t level_map;
+  int8_t priority;
+  rsi_event_cb_t *temp_event;
+
+  for (priority = RSI_SCHEDULER_NUM_PRIORITIES - 1; (priority >= 0) && event_map; priority--) {
+    level_map = (event_map & scheduler_cb->priority_map[priority]);
+    event_map &= ~level_map;
+
+    while (level_map) {
+      // Find event
+      event_no = RSI_EVENT_CTZ(level_map);
+      level_map &= (level_map - 1);
+
+      // Skip event cleared or masked by a handler called earlier from this snapshot
+      if (!(scheduler_cb->event_map & scheduler_cb->mask_map & BIT(event_no))) {
+        continue;
+      }
+
+      // Get event handler
+      temp_event = &rsi_driver_cb->event_list[event_no];
+
+      if (temp_event->event_handler) {
+        // Call event handler
+        temp_event->event_handler();
+      } else {
+
+        rsi_clear_event(event_no); //Clear unregistered events
+        rsi_driver_cb->unregistered_event_callback(event_no);
+      }
+    }
+  }
+}
+
 /*====================================================*/
 /**
  * @fn          uint32_t rsi_get_event_non_rom(rsi_scheduler_cb_t *scheduler_cb)
@@ -133,11 +178,8 @@ uint32_t rsi_get_event_non_rom(rsi_scheduler_cb_t *scheduler_cb)
 
   void rsi_scheduler_non_rom(rsi_scheduler_cb_t * scheduler_cb)
   {
-    uint32_t event_no;
-    rsi_event_cb_t *temp_event;
-
-    rsi_driver_cb_t *rsi_driver_cb = global_cb_p->rsi_driver_cb;
-    uint32_t max_block_time        = 0xFFFFFFFF;
+    uint32_t event_map;
+    uint32_t max_block_time = 0xFFFFFFFF;
     rsi_base_type_t retval;
     // Wait for events
 
@@ -146,22 +188,9 @@ uint32_t rsi_get_event_non_rom(rsi_scheduler_cb_t *scheduler_cb)
                                   (uint32_t *)&rsi_driver_eventmap, /* Stores the notified value. */
                                   max_block_time);
     if (retval == 1) {
-      while (rsi_get_event(scheduler_cb)) {
-        // Find event event
-
-        event_no = rsi_find_event((scheduler_cb->event_map & scheduler_cb->mask_map));
-
-        // Get event handler
-        temp_event = &rsi_driver_cb->event_list[event_no];
-
-        if (temp_event->event_handler) {
-          // Call event handler
-          temp_event->event_handler();
-        } else {
-
-          rsi_clear_event(event_no); //Clear unregistered events
-          global_cb_p->rsi_driver_cb->unregistered_event_callback(event_no);
-        }
+      // Snapshot pending events once and dispatch all of them
+      while ((event_map = rsi_get_event(scheduler_cb)) != 0) {
+        rsi_scheduler_dispatch(scheduler_cb, event_map);
 
         if (global_cb_p->os_enabled != 1) {
           break;
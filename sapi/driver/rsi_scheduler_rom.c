@@ -44,6 +44,10 @@ void ROM_WL_rsi_scheduler_init(global_cb_t *global_cb_p, rsi_scheduler_cb_t *sch
   // Set no mask
   scheduler_cb->mask_map = 0xFFFFFFFF;
 
+  // Set all events to default priority
+  memset(scheduler_cb->priority_map, 0, sizeof(scheduler_cb->priority_map));
+  scheduler_cb->priority_map[RSI_EVENT_PRIORITY_DEFAULT] = 0xFFFFFFFF;
+
   if (global_cb_p->os_enabled == 1) {
     // create semaphore
     RSI_SEMAPHORE_CREATE(&scheduler_cb->scheduler_sem, 0);
@@ -91,31 +95,21 @@ uint32_t ROM_WL_rsi_get_event(global_cb_t *global_cb_p, rsi_scheduler_cb_t *sche
 /// @private
 void ROM_WL_rsi_scheduler(global_cb_t *global_cb_p, rsi_scheduler_cb_t *scheduler_cb)
 {
-  uint32_t event_no;
-  rsi_event_cb_t *temp_event;
+  uint32_t event_map;
 
-  rsi_driver_cb_t *rsi_driver_cb = global_cb_p->rsi_driver_cb;
+  while (1) {
+    // Snapshot pending events once and dispatch all of them
 #ifdef RSI_M4_INTERFACE
-  while (ROM_WL_rsi_get_event(global_cb_p, scheduler_cb))
+    event_map = ROM_WL_rsi_get_event(global_cb_p, scheduler_cb);
 #else
-  while (rsi_get_event(scheduler_cb))
+    event_map = rsi_get_event(scheduler_cb);
 #endif
-  {
-    // Find event event
-    event_no = ROM_WL_rsi_find_event(global_cb_p, (scheduler_cb->event_map & scheduler_cb->mask_map));
-
-    // Get event handler
-    temp_event = &rsi_driver_cb->event_list[event_no];
-
-    if (temp_event->event_handler) {
-      // Call event handler
-      temp_event->event_handler();
-    } else {
-
-      ROM_WL_rsi_clear_event(global_cb_p, event_no); //Clear unregistered events
-      global_cb_p->rsi_driver_cb->unregistered_event_callback(event_no);
+    if (!event_map) {
+      break;
     }
 
+    rsi_scheduler_dispatch(scheduler_cb, event_map);
+
     if (global_cb_p->os_enabled != 1) {
       break;
     }
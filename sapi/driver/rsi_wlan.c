@@ -945,6 +945,12 @@ int32_t rsi_driver_process_wlan_recv_cmd(rsi_pkt_t *pkt)
             if ((socket_select_rsp->rsi_read_fds.fd_array[0]) & BIT(rsi_socket_pool[i].sock_id)) {
               fd_read->fd_count++;
               RSI_FD_SET(i, fd_read);
+              // Remember data is pending until it is requested, asynchronous sockets get it without request.
+              // Readable listening socket has connections pending, which only module knows the count of.
+              if ((rsi_socket_pool[i].sock_bitmap & RSI_SOCKET_FEAT_SYNCHRONOUS)
+                  && (rsi_socket_pool[i].sock_state != RSI_SOCKET_STATE_LISTEN)) {
+                rsi_socket_pool_non_rom[i].ready_to_read = 1;
+              }
             }
           }
           //set the writefd
@@ -1494,7 +1500,7 @@ int32_t rsi_driver_process_wlan_recv_cmd(rsi_pkt_t *pkt)
 
         // Save socket id
         if (socket_type != RSI_SOCKET_TCP_SERVER) {
-          rsi_socket_pool[sockID].sock_id = sock_id;
+          rsi_socket_set_module_id(sockID, sock_id);
         }
         if (socket_type == RSI_SOCKET_TCP_SERVER) {
           // Update state to listen is success
@@ -1563,7 +1569,7 @@ int32_t rsi_driver_process_wlan_recv_cmd(rsi_pkt_t *pkt)
         // Update the state as connected
         rsi_socket_pool[sockID].sock_state = RSI_SOCKET_STATE_CONNECTED;
         // Save socket id
-        rsi_socket_pool[sockID].sock_id = sock_id;
+        rsi_socket_set_module_id(sockID, sock_id);
 
         // Save destination port number
         rsi_socket_pool[sockID].destination_port = rsi_bytes2R_to_uint16(ltcp->dest_port);
@@ -1599,6 +1605,7 @@ int32_t rsi_driver_process_wlan_recv_cmd(rsi_pkt_t *pkt)
       if (sockID < 0 || (sockID >= RSI_NUMBER_OF_SOCKETS)) {
         break;
       }
+      rsi_epoll_notify(sockID, RSI_EPOLLIN | RSI_EPOLLHUP);
       // Clear socket info
       if (rsi_wlan_cb_non_rom->callback_list.remote_socket_terminate_handler != NULL) {
         // Changing the callback response f/w socket id to app socket id.
@@ -1873,6 +1880,13 @@ int32_t rsi_driver_process_wlan_recv_cmd(rsi_pkt_t *pkt)
       if (rsi_wlan_cb_non_rom->nwk_callbacks.data_transfer_complete_handler) {
         rsi_wlan_cb_non_rom->nwk_callbacks.data_transfer_complete_handler(sockID, length);
       }
+      rsi_epoll_notify(sockID, RSI_EPOLLOUT);
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+      // Large data send waiting for module buffers can continue
+      if (rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID)) {
+        rsi_set_event(RSI_SOCKET_EVENT);
+      }
+#endif
 
       rsi_wlan_socket_set_status(status, sockID);
 #ifndef RSI_SOCK_SEM_BITMAP
@@ -2286,6 +2300,19 @@ int32_t rsi_driver_process_wlan_recv_cmd(rsi_pkt_t *pkt)
   } else if (cmd_type == RSI_WLAN_RSP_SOCKET_CREATE || cmd_type == RSI_WLAN_RSP_CONN_ESTABLISH) {
     if (sockID >= 0 && sockID < NUMBER_OF_SOCKETS) {
       rsi_wlan_socket_set_status(status, sockID);
+      // Complete non-blocking connect or accept, failed accept response does not identify the socket
+      if (rsi_socket_pool_non_rom[sockID].connect_pending
+          && ((cmd_type == RSI_WLAN_RSP_SOCKET_CREATE) || (status == RSI_SUCCESS))) {
+        rsi_socket_pool_non_rom[sockID].connect_pending = 0;
+        rsi_socket_pool_non_rom[sockID].ready_to_write  = 1;
+        rsi_epoll_notify(sockID, (status == RSI_SUCCESS) ? RSI_EPOLLOUT : RSI_EPOLLERR);
+        // Listening socket has a connection to accept
+        for (i = 0; i < NUMBER_OF_SOCKETS; i++) {
+          if (rsi_socket_pool_non_rom[i].accept_pending_id == (sockID + 1)) {
+            rsi_epoll_notify(i, RSI_EPOLLIN);
+          }
+        }
+      }
       if (rsi_socket_pool_non_rom[sockID].socket_wait_bitmap & BIT(0)) {
 #ifndef RSI_SOCK_SEM_BITMAP
         rsi_socket_pool_non_rom[sockID].socket_wait_bitmap &= ~BIT(0);
@@ -2725,6 +2752,7 @@ int32_t rsi_post_waiting_semaphore(void)
     if (rsi_socket_pool[i].sock_state > RSI_SOCKET_STATE_INIT) {
       // Set error
       rsi_wlan_socket_set_status(RSI_ERROR_IN_WLAN_CMD, i);
+      rsi_epoll_notify(i, RSI_EPOLLERR | RSI_EPOLLHUP);
       // post on  semaphore
       rsi_post_waiting_socket_semaphore(i);
 #ifdef SOCKET_CLOSE_WAIT
@@ -2870,6 +2898,41 @@ void rsi_wlan_process_raw_data(rsi_pkt_t *pkt)
   }
 }
 
+/*==============================================*/
+/**
+ * @fn          rsi_pkt_pool_t *rsi_wlan_get_data_tx_pool(void)
+ * @brief       Get the packet pool to allocate WLAN data (RSI_WLAN_DATA_Q) frames from.
+ * @param[in]   void
+ * @return      WLAN data tx pool if configured, WLAN tx pool otherwise
+ *
+ */
+/// @private
+rsi_pkt_pool_t *rsi_wlan_get_data_tx_pool(void)
+{
+  if ((rsi_wlan_cb_non_rom != NULL) && (rsi_wlan_cb_non_rom->wlan_data_tx_pool.size != 0)) {
+    return &rsi_wlan_cb_non_rom->wlan_data_tx_pool;
+  }
+  return &rsi_driver_cb->wlan_cb->wlan_tx_pool;
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_wlan_free_tx_pkt(rsi_pkt_t *pkt)
+ * @brief       Free a WLAN tx packet to the pool it was allocated from.
+ * @param[in]   pkt - pointer to packet, with host descriptor filled
+ * @return      void
+ *
+ */
+/// @private
+void rsi_wlan_free_tx_pkt(rsi_pkt_t *pkt)
+{
+  if (((pkt->desc[1] & 0xf0) >> 4) == RSI_WLAN_DATA_Q) {
+    rsi_pkt_free(rsi_wlan_get_data_tx_pool(), pkt);
+  } else {
+    rsi_pkt_free(&rsi_driver_cb->wlan_cb->wlan_tx_pool, pkt);
+  }
+}
+
 /*==============================================*/
 /**
  * @fn          void rsi_wlan_packet_transfer_done(rsi_pkt_t *pkt)
@@ -2882,15 +2945,12 @@ void rsi_wlan_process_raw_data(rsi_pkt_t *pkt)
 void rsi_wlan_packet_transfer_done(rsi_pkt_t *pkt)
 {
   // uint8_t queueno = 0xff;
-#ifndef RSI_UART_INTERFACE
-  uint8_t queueno; // To avoid warning for unused variable 'queueno' added the macros.
+  uint8_t queueno;
   uint8_t frame_type;
   uint8_t *buf_ptr;
   rsi_req_socket_send_t *send;
   int32_t sockID;
-#endif
 
-#ifndef RSI_UART_INTERFACE
   buf_ptr = (uint8_t *)pkt->desc;
 
   // Get Frame type
@@ -2901,10 +2961,16 @@ void rsi_wlan_packet_transfer_done(rsi_pkt_t *pkt)
 
   // Get protocol type
   queueno = (buf_ptr[1] & 0xf0) >> 4;
-#endif
 
   // Set wlan status as success
   rsi_wlan_set_status(RSI_SUCCESS);
+  // Statistics count the packet written to module on UART as well, where send completion is the data ACK
+  if ((queueno == RSI_WLAN_DATA_Q) && (frame_type != 0x1)) {
+    sockID = rsi_get_application_socket_descriptor(send->socket_id[0]);
+    if ((sockID >= 0) && (sockID < RSI_NUMBER_OF_SOCKETS)) {
+      rsi_socket_stats_tx_done(sockID, 1);
+    }
+  }
 #ifndef RSI_UART_INTERFACE
   if (queueno == RSI_WLAN_DATA_Q) {
     if (frame_type == 0x1) {
@@ -2912,10 +2978,16 @@ void rsi_wlan_packet_transfer_done(rsi_pkt_t *pkt)
       rsi_driver_cb_non_rom->send_wait_bitmap &= ~BIT(0);
 #endif
       rsi_semaphore_post(&rsi_driver_cb_non_rom->send_data_sem);
+#if (RSI_SOCKET_TX_PIPELINE_DEPTH || RSI_SOCKET_TX_BATCH)
+    } else if (rsi_socket_tx_pipe_done(pkt, RSI_SUCCESS)) {
+      // Packet of large data send or batch send, reported once all its packets are written
+#endif
     } else if (rsi_driver_cb->wlan_cb->expected_response != RSI_WLAN_RSP_TCP_ACK_INDICATION) {
       sockID = rsi_get_application_socket_descriptor(send->socket_id[0]);
       if ((sockID >= 0) && (sockID < RSI_NUMBER_OF_SOCKETS)) {
         rsi_wlan_socket_set_status(RSI_SUCCESS, sockID);
+        rsi_socket_pool_non_rom[sockID].ready_to_write = 1;
+        rsi_epoll_notify(sockID, RSI_EPOLLOUT);
 #ifndef RSI_SOCK_SEM_BITMAP
         rsi_socket_pool_non_rom[sockID].socket_wait_bitmap &= ~BIT(2);
         RSI_SEMAPHORE_POST(&rsi_socket_pool_non_rom[sockID].sock_send_sem);
@@ -2927,7 +2999,7 @@ void rsi_wlan_packet_transfer_done(rsi_pkt_t *pkt)
   }
 #endif
   // Free the wlan tx pkt
-  rsi_pkt_free(&rsi_driver_cb->wlan_cb->wlan_tx_pool, pkt);
+  rsi_wlan_free_tx_pkt(pkt);
 }
 
 /*==============================================*/
@@ -2958,16 +3030,27 @@ void rsi_check_wlan_buffer_full(rsi_pkt_t *pkt)
   queueno = (buf_ptr[1] & 0xf0) >> 4;
   // Set wlan status as TX buffer full
   rsi_wlan_set_status(RSI_TX_BUFFER_FULL);
+  if ((queueno == RSI_WLAN_DATA_Q) && (frame_type != 0x1)) {
+    sockID = rsi_get_application_socket_descriptor(send->socket_id[0]);
+    if (sockID >= 0 && sockID < NUMBER_OF_SOCKETS) {
+      rsi_socket_stats_tx_done(sockID, 0);
+    }
+  }
   if (queueno == RSI_WLAN_DATA_Q) {
     if (frame_type == 0x1) {
 #ifndef RSI_SEND_SEM_BITMAP
       rsi_driver_cb_non_rom->send_wait_bitmap &= ~BIT(0);
 #endif
       rsi_semaphore_post(&rsi_driver_cb_non_rom->send_data_sem);
+#if (RSI_SOCKET_TX_PIPELINE_DEPTH || RSI_SOCKET_TX_BATCH)
+    } else if (rsi_socket_tx_pipe_done(pkt, RSI_TX_BUFFER_FULL)) {
+      // Packet of large data send or batch send is dropped, the send fails
+#endif
     } else if (rsi_driver_cb->wlan_cb->expected_response != RSI_WLAN_RSP_TCP_ACK_INDICATION) {
       sockID = rsi_get_application_socket_descriptor(send->socket_id[0]);
       if (sockID >= 0 && sockID < NUMBER_OF_SOCKETS) {
         rsi_wlan_socket_set_status(RSI_SUCCESS, sockID);
+        rsi_socket_pool_non_rom[sockID].ready_to_write = 0;
 #ifndef RSI_SOCK_SEM_BITMAP
         rsi_socket_pool_non_rom[sockID].socket_wait_bitmap &= ~BIT(2);
 #endif
@@ -2975,8 +3058,10 @@ void rsi_check_wlan_buffer_full(rsi_pkt_t *pkt)
       }
     }
   }
+  // Drop external payload attached to the packet, if any
+  rsi_pkt_detach_payload(pkt, NULL);
   // Free the wlan tx pkt
-  rsi_pkt_free(&rsi_driver_cb->wlan_cb->wlan_tx_pool, pkt);
+  rsi_wlan_free_tx_pkt(pkt);
 }
 
 /*==============================================*/
@@ -86,7 +86,34 @@
 #define RSI_SPI_MODE_REG_ADDR   0x08 //@ register access method
 #define RSI_SPI_LENGTH_REG_ADDR 0x20
 
+// Flags of a batched module memory access
+#define RSI_MEM_ACCESS_READ     0
+#define RSI_MEM_ACCESS_WRITE    BIT(0)
+#define RSI_MEM_ACCESS_NO_MERGE BIT(1) // issued on its own, never merged with its neighbours
+
+// Module memory access queued to rsi_mem_access_batch()
+typedef struct rsi_mem_access_s {
+  // Module address
+  uint32_t addr;
+
+  // Data to write, or buffer to read into
+  uint8_t *buf;
+
+  // Number of bytes
+  uint16_t len;
+
+  // RSI_MEM_ACCESS_xxx flags
+  uint8_t flags;
+} rsi_mem_access_t;
+
+// Reads len bytes at offset of the firmware file into buf for rsi_bl_upgrade_firmware_stream(), returns 0 on success
+typedef int16_t (*rsi_fw_image_reader_t)(void *context, uint32_t offset, uint8_t *buf, uint16_t len);
+
 int16_t rsi_bl_upgrade_firmware(uint8_t *firmware_image, uint32_t fw_image_size, uint8_t flags);
+int16_t rsi_bl_upgrade_firmware_stream(rsi_fw_image_reader_t reader,
+                                       void *context,
+                                       uint32_t fw_image_size,
+                                       uint8_t *chunk_buf);
 int32_t rsi_device_deinit(void);
 int32_t rsi_device_init(uint8_t select_option);
 int16_t rsi_bootloader_instructions(uint8_t type, uint16_t *data);
@@ -100,5 +127,6 @@ int16_t rsi_waitfor_boardready(void);
 int16_t rsi_select_option(uint8_t cmd);
 int32_t rsi_get_rom_version(void);
 int32_t rsi_get_ram_dump(uint32_t addr, uint16_t length, uint8_t *buf);
+int32_t rsi_mem_access_batch(const rsi_mem_access_t *access, uint16_t count);
 
 #endif
@@ -38,6 +38,11 @@
 // Max packet length of ZigBee tx packet
 #define RSI_ZIGB_CMD_LEN 256
 
+// pool size of a packet pool with given packet length and count
+#define RSI_PKT_POOL_SIZE(pkt_len, pkt_count)          \
+  ((((((uint32_t)(sizeof(rsi_pkt_pool_t))) + 3) & ~3)) \
+   + ((((uint32_t)(pkt_len)) + sizeof(void *)) * (pkt_count)))
+
 // pool size of WLAN tx packets
 #define RSI_WLAN_POOL_SIZE                             \
   ((((((uint32_t)(sizeof(rsi_pkt_pool_t))) + 3) & ~3)) \
@@ -79,10 +84,15 @@
   (((((uint32_t)(sizeof(rsi_socket_info_non_rom_t))) + 3) & ~3) * RSI_NUMBER_OF_SOCKETS)
 #define RSI_SOCKET_SELECT_INFO_POOL_SIZE \
   (((((uint32_t)(sizeof(rsi_socket_select_info_t))) + 3) & ~3) * RSI_NUMBER_OF_SELECTS)
+#define RSI_SOCKET_EPOLL_INFO_POOL_SIZE \
+  (((((uint32_t)(sizeof(rsi_socket_epoll_info_t))) + 3) & ~3) * RSI_NUMBER_OF_EPOLLS)
+#define RSI_SOCKET_RX_RING_POOL_SIZE (((RSI_SOCKET_RX_RING_SIZE + 3) & ~3) * RSI_NUMBER_OF_SOCKETS)
 #else
 #define RSI_SOCKET_INFO_POOL_SIZE        0
 #define RSI_SOCKET_INFO_POOL_ROM_SIZE    0
 #define RSI_SOCKET_SELECT_INFO_POOL_SIZE 0
+#define RSI_SOCKET_EPOLL_INFO_POOL_SIZE  0
+#define RSI_SOCKET_RX_RING_POOL_SIZE     0
 #endif
 // Max packet length of BT COMMON tx packet
 #define RSI_BT_COMMON_CMD_LEN 300 //TODO Fix it
@@ -135,6 +145,13 @@
 
 #define RSI_WLAN_CB_NON_ROM_POOL_SIZE ((((uint32_t)(sizeof(rsi_wlan_cb_non_rom_t))) + 3) & ~3)
 
+// pool size of WLAN data tx packets
+#if (defined RSI_WLAN_ENABLE) && (RSI_WLAN_DATA_TX_POOL_PKT_COUNT > 0)
+#define RSI_WLAN_DATA_POOL_SIZE RSI_PKT_POOL_SIZE(RSI_WLAN_CMD_LEN, RSI_WLAN_DATA_TX_POOL_PKT_COUNT)
+#else
+#define RSI_WLAN_DATA_POOL_SIZE 0
+#endif
+
 #ifdef RSI_ZB_ENABLE
 #ifdef ZB_MAC_API
 #define ZB_GLOBAL_BUF_SIZE ((((uint32_t)(sizeof(rsi_zigb_global_mac_cb_t))) + 3) & ~3)
@@ -192,10 +209,12 @@
     + ((((uint32_t)(sizeof(rsi_common_cb_t))) + 3) & ~3) + ((((uint32_t)(sizeof(rsi_driver_cb_non_rom_t))) + 3) & ~3) \
     + RSI_COMMON_POOL_SIZE + ((((uint32_t)(sizeof(rsi_wlan_cb_t))) + 3) & ~3) + RSI_WLAN_POOL_SIZE                    \
     + RSI_M4_MEMORY_POOL_SIZE + RSI_SOCKET_INFO_POOL_SIZE + RSI_SOCKET_INFO_POOL_ROM_SIZE                             \
-    + RSI_SOCKET_SELECT_INFO_POOL_SIZE + SCAN_RESULTS_MEMORY_POOL_SIZE + RSI_ZB_MEMORY_POOL_SIZE                      \
+    + RSI_SOCKET_SELECT_INFO_POOL_SIZE + RSI_SOCKET_EPOLL_INFO_POOL_SIZE + SCAN_RESULTS_MEMORY_POOL_SIZE               \
+    + RSI_SOCKET_RX_RING_POOL_SIZE + RSI_ZB_MEMORY_POOL_SIZE                                                          \
     + RSI_BT_BLE_PROP_PROTOCOL_MEMORY_POOL_SIZE + RSI_BT_MEMORY_POOL_SIZE + RSI_BLE_MEMORY_POOL_SIZE                  \
     + PROP_PROTOCOL_MEMORY_SIZE + BT_STACK_ON_HOST_MEMORY + RSI_EVENT_INFO_POOL_SIZE + RSI_WLAN_CB_NON_ROM_POOL_SIZE  \
-    + ((((uint32_t)(sizeof(global_cb_t))) + 3) & ~3) + ((((uint32_t)(sizeof(rom_apis_t))) + 3) & ~3)
+    + ((((uint32_t)(sizeof(global_cb_t))) + 3) & ~3) + ((((uint32_t)(sizeof(rom_apis_t))) + 3) & ~3)                  \
+    + RSI_WLAN_DATA_POOL_SIZE
 
 #define RSI_WAIT_FOREVER            0
 #define RSI_ZIGB_RESPONSE_WAIT_TIME RSI_WAIT_FOREVER
@@ -794,6 +813,48 @@ typedef enum {
 #if ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
 #define SDIO_BUFFER_LENGTH 2048
 #endif
+
+// Maximum number of TX packets with an external payload attached at a time
+#ifndef RSI_TX_GATHER_MAX
+#define RSI_TX_GATHER_MAX 4
+#endif
+
+// External payload written right after the payload of a TX packet
+typedef struct rsi_tx_gather_s {
+  // Packet the payload is attached to, NULL if entry is free
+  rsi_pkt_t *pkt;
+
+  // External payload segment
+  rsi_frame_iovec_t payload;
+
+  // Set while the payload is copied into the packet by rsi_pkt_release_payload()
+  volatile uint8_t copying;
+} rsi_tx_gather_t;
+
+// TX arbitration control block
+typedef struct rsi_tx_arb_cb_s {
+  // Selected policy, one of rsi_tx_arb_policy_t
+  uint8_t policy;
+
+  // DRR queue currently holding the turn
+  uint8_t drr_current;
+
+  // Whether the current DRR queue already got its quantum in this turn
+  uint8_t drr_quantum_added;
+
+  // Bitmap of queues with a valid head of line timestamp
+  uint8_t hol_valid;
+
+  uint16_t quantum[RSI_TX_ARB_MAX_Q];
+  uint16_t latency_target_ms[RSI_TX_ARB_MAX_Q];
+  uint32_t deficit[RSI_TX_ARB_MAX_Q];
+
+  // Time at which the current head packet of each queue started waiting
+  uint32_t hol_since[RSI_TX_ARB_MAX_Q];
+
+  rsi_tx_arb_stats_t stats[RSI_TX_ARB_MAX_Q];
+} rsi_tx_arb_cb_t;
+
 typedef struct rsi_driver_cb_non_rom {
   uint32_t rom_version_info;
   uint32_t tx_mask_event;
@@ -833,15 +894,41 @@ typedef struct rsi_driver_cb_non_rom {
   uint32_t rsi_spiTimer2;
   uint32_t rsi_spiTimer3;
   uint32_t rsi_spiTimer4;
+  //! Signalled by HAL when asynchronous SPI transfer is completed
+  rsi_semaphore_handle_t spi_transfer_sem;
+  //! Set while module answers C1 at once, then C1 to C4 are sent in a single transfer
+  uint8_t spi_ready;
+  rsi_spi_stats_t spi_stats;
 #endif
 #ifdef RSI_SDIO_INTERFACE
   uint32_t rsi_sdioTimer;
+  //! Set while module memory window registers are written only when they change
+  uint8_t sdio_mem_window_hold;
+  //! Set while module memory window registers are known to hold sdio_mem_window
+  uint8_t sdio_mem_window_valid;
+  uint16_t sdio_mem_window;
 #endif
 #if ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
   uint8_t sdio_read_buff[SDIO_BUFFER_LENGTH];
 #endif
   //! timer flag
   uint32_t rx_driver_flag;
+  //! TX queue arbitration state
+  rsi_tx_arb_cb_t tx_arb;
+  //! Number of RX packets loaned to application socket handlers
+  volatile uint16_t rx_loan_count;
+  //! External payloads of TX packets sent using scatter-gather frame write
+  rsi_tx_gather_t tx_gather[RSI_TX_GATHER_MAX];
+  //! Number of valid entries in tx_gather
+  volatile uint8_t tx_gather_count;
+  //! Packet whose external payload is being written to the module by the driver task
+  rsi_pkt_t *volatile tx_gather_writing;
+  //! Packet a task waits for on tx_gather_sem, to be written by driver task or copied by rsi_pkt_release_payload()
+  rsi_pkt_t *volatile tx_gather_waiting;
+  //! Signalled when tx_gather_waiting is done with
+  rsi_semaphore_handle_t tx_gather_sem;
+  //! Frames module takes before buffer full is checked again, see RSI_MODULE_TX_CREDITS
+  volatile uint16_t module_tx_credits;
   volatile rsi_device_state_t device_state;
 #ifndef RSI_WAIT_TIMEOUT_EVENT_HANDLE_TIMER_DISABLE
   //error response handler pointer
@@ -891,6 +978,7 @@ void rsi_register_wait_timeout_error_callbacks(void (*callback_handler_ptr)(int3
 void rsi_error_timeout_and_clear_events(int32_t error, uint32_t cmd_type);
 #endif
 int32_t rsi_check_waiting_cmds(rsi_rsp_waiting_cmds_t *response);
+void rsi_tx_arb_init(rsi_tx_arb_cb_t *arb, const rsi_driver_config_t *config);
 #ifdef RSI_CHIP_MFG_EN
 int32_t rsi_common_dev_params();
 int32_t rsi_wait_for_card_ready();
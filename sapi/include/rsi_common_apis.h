@@ -94,6 +94,35 @@ typedef struct rsi_gpio_pin_config_s {
  * *                   Enumerations
  * ******************************************************/
 
+// enumerations for TX arbitration policy across driver TX queues
+typedef enum rsi_tx_arb_policy_e {
+  RSI_TX_ARB_STRICT_PRIORITY = 0,
+  RSI_TX_ARB_DRR             = 1,
+  RSI_TX_ARB_LATENCY_TARGET  = 2
+} rsi_tx_arb_policy_t;
+
+// enumerations for driver TX queues taking part in TX arbitration, in strict priority order
+typedef enum rsi_tx_arb_queue_e {
+  RSI_TX_ARB_COMMON_Q        = 0,
+  RSI_TX_ARB_BT_Q            = 1,
+  RSI_TX_ARB_PROP_PROTOCOL_Q = 2,
+  RSI_TX_ARB_ZB_Q            = 3,
+  RSI_TX_ARB_WLAN_Q          = 4,
+  RSI_TX_ARB_MAX_Q           = 5
+} rsi_tx_arb_queue_t;
+
+// enumerations for driver packet pools whose depth is configurable
+typedef enum rsi_pkt_pool_class_e {
+  RSI_PKT_POOL_WLAN_DATA  = 0,
+  RSI_PKT_POOL_WLAN_MGMT  = 1,
+  RSI_PKT_POOL_COMMON     = 2,
+  RSI_PKT_POOL_BT_COMMON  = 3,
+  RSI_PKT_POOL_BT_CLASSIC = 4,
+  RSI_PKT_POOL_BLE        = 5,
+  RSI_PKT_POOL_RX         = 6,
+  RSI_PKT_POOL_MAX        = 7
+} rsi_pkt_pool_class_t;
+
 // enumerations for power save profile modes
 typedef enum rsi_power_save_profile_mode_e {
   RSI_ACTIVE        = 0,
@@ -144,14 +173,80 @@ typedef enum rsi_gpio_config_mode_e { RSI_CONFIG_GPIO = 0, RSI_SET_GPIO = 1, RSI
 /******************************************************
  * *                    Structures
  * ******************************************************/
+#include <stdint.h>
+#include <rsi_pkt_mgmt.h>
+
+// Driver configuration given to rsi_driver_init_with_config()
+typedef struct rsi_driver_config_s {
+  // TX arbitration policy, one of rsi_tx_arb_policy_t
+  uint8_t tx_arb_policy;
+
+  // Bytes credited to each queue per round in RSI_TX_ARB_DRR policy
+  uint16_t tx_arb_quantum[RSI_TX_ARB_MAX_Q];
+
+  // Head of line wait in ms after which a queue is served first in RSI_TX_ARB_LATENCY_TARGET policy, 0 for none
+  uint16_t tx_arb_latency_target_ms[RSI_TX_ARB_MAX_Q];
+
+  // Number of packets in each driver packet pool, indexed by rsi_pkt_pool_class_t.
+  // WLAN data count 0 makes data frames share the WLAN management pool.
+  uint16_t pool_pkt_count[RSI_PKT_POOL_MAX];
+
+  // Available packet counts at which pool_watermark_cb reports low and high watermark,
+  // a pool is watched only if its high watermark is above its low watermark
+  uint16_t pool_low_watermark[RSI_PKT_POOL_MAX];
+  uint16_t pool_high_watermark[RSI_PKT_POOL_MAX];
+
+  // Packet pool watermark callback, event is RSI_PKT_POOL_LOW_WATERMARK or RSI_PKT_POOL_HIGH_WATERMARK
+  void (*pool_watermark_cb)(struct rsi_pkt_pool_s *pool_cb, uint8_t event, uint16_t avail);
+
+  // Set to create a pool as lock free single producer/single consumer ring, indexed by rsi_pkt_pool_class_t.
+  // Only valid for pools in RSI_PKT_POOL_LOCK_FREE_CLASSES (BT common, BT classic and BLE).
+  uint8_t pool_lock_free[RSI_PKT_POOL_MAX];
+
+} rsi_driver_config_t;
+
+// Per TX queue arbitration statistics
+typedef struct rsi_tx_arb_stats_s {
+  // Number of frames written to module from this queue
+  uint32_t frames;
+
+  // Number of payload bytes written to module from this queue
+  uint32_t bytes;
+
+  // Accumulated head of line wait time in ms
+  uint32_t wait_time_ms;
+
+  // Largest head of line wait time in ms
+  uint32_t max_wait_time_ms;
+
+} rsi_tx_arb_stats_t;
+
+// SPI command protocol statistics
+typedef struct rsi_spi_stats_s {
+  // Number of commands sent with C1 to C4 in a single transfer
+  uint32_t merged_cmds;
+
+  // Number of busy answers of module to C1, each followed by a retry
+  uint32_t busy_retries;
+
+  // Number of transfers made polling for start token
+  uint32_t token_polls;
+
+} rsi_spi_stats_t;
+
 /******************************************************
  * *                 Global Variables
  * ******************************************************/
 /******************************************************
  * *               Function Declarations
  * ******************************************************/
-#include <stdint.h>
 extern int32_t rsi_driver_init(uint8_t *buffer, uint32_t length);
+extern void rsi_driver_config_init(rsi_driver_config_t *config);
+extern int32_t rsi_driver_init_with_config(uint8_t *buffer, uint32_t length, const rsi_driver_config_t *config);
+extern int32_t rsi_driver_get_tx_arb_stats(uint8_t queue, rsi_tx_arb_stats_t *stats);
+extern int32_t rsi_driver_get_spi_stats(rsi_spi_stats_t *stats);
+extern int32_t rsi_driver_memory_estimate_with_config(const rsi_driver_config_t *config);
+extern struct rsi_pkt_pool_s *rsi_driver_get_pkt_pool(uint8_t pool_class);
 extern int32_t rsi_driver_deinit(void);
 extern int32_t rsi_wireless_init(uint16_t opermode, uint16_t coex_mode);
 extern int32_t rsi_wireless_antenna(uint8_t type, uint8_t gain_2g, uint8_t gain_5g);
@@ -216,6 +216,131 @@ typedef struct rsi_driver_cb_s {
 #if !defined(RSI_PKT_FREE_RESPONSE_WAIT_TIME)
 #define RSI_PKT_FREE_RESPONSE_WAIT_TIME  600000
 #endif
+// Time rsi_pkt_alloc_non_blocking() waits for an allocation in progress in another task to finish
+#if !defined(RSI_PKT_ALLOC_NON_BLOCKING_WAIT_TIME)
+#define RSI_PKT_ALLOC_NON_BLOCKING_WAIT_TIME 1
+#endif
+// Maximum number of frames written to the module per TX event
+#if !defined(RSI_TX_BURST_MAX_FRAMES)
+#define RSI_TX_BURST_MAX_FRAMES 1
+#endif
+// Number of frames written to the module after it reports buffer not full, before the interrupt
+// status register is read again. Must not exceed the TX buffers module keeps for the host.
+// Granted only by the read before a frame; buffer full seen by the RX event revokes them.
+#if !defined(RSI_MODULE_TX_CREDITS)
+#define RSI_MODULE_TX_CREDITS RSI_TX_BURST_MAX_FRAMES
+#endif
+// Maximum number of frames read from the module per RX event while it reports more pending,
+// host interrupt is re-armed once per drain. Used on SPI and SDIO interfaces.
+#if !defined(RSI_RX_DRAIN_BUDGET)
+#define RSI_RX_DRAIN_BUDGET 1
+#endif
+// Default TX arbitration policy and its per queue parameters, see rsi_driver_config_t
+#if !defined(RSI_TX_ARB_POLICY)
+#define RSI_TX_ARB_POLICY RSI_TX_ARB_STRICT_PRIORITY
+#endif
+#if !defined(RSI_TX_ARB_QUANTUM)
+#define RSI_TX_ARB_QUANTUM 1600
+#endif
+#if !defined(RSI_TX_ARB_LATENCY_TARGET_MS)
+#define RSI_TX_ARB_LATENCY_TARGET_MS 20
+#endif
+
+// Minimum socket send length from which the user buffer is written to the module directly
+// using scatter-gather frame write instead of being copied into the data packet, 0 disables.
+// Disabled by default, as a send timing out has to copy the payload into the packet before
+// returning. Not used on SDIO or M4, where frames are moved in blocks from a single buffer anyway.
+#if !defined(RSI_TX_GATHER_MIN_LEN)
+#define RSI_TX_GATHER_MIN_LEN 0
+#endif
+
+// Minimum SPI transfer length made using rsi_spi_transfer_async() of HAL, the driver task blocks
+// on its completion instead of the HAL spinning on DMA, so other tasks run meanwhile. 0 disables.
+// Shorter transfers are done by rsi_spi_transfer(), as blocking costs more than they take.
+// Disabled by default, as only HALs of some platforms provide rsi_spi_transfer_async() and
+// rsi_spi_transfer_abort(). Set to 256 for RSI_WITH_OS builds on such a platform.
+#if !defined(RSI_SPI_ASYNC_MIN_LEN)
+#define RSI_SPI_ASYNC_MIN_LEN 0
+#endif
+
+// Send C1 to C4 command bytes in a single SPI transfer while module answers commands without
+// being busy, instead of C1/C2 and C3/C4 transfers. 0 disables.
+#if !defined(RSI_SPI_MERGED_CMD)
+#define RSI_SPI_MERGED_CMD 1
+#endif
+
+// Number of frame bytes read on SPI along with the pre-descriptor, in a single transaction, multiple of 4.
+// Frames that fit are read at once, only the rest of longer ones is read by a second transaction.
+// Shorter frames are read past their end, so it is to be enabled only where the module allows it. 0 disables.
+#if !defined(RSI_SPI_RX_PREFIX_LEN)
+#define RSI_SPI_RX_PREFIX_LEN 0
+#endif
+
+// Maximum length of a module memory access made by rsi_mem_access_batch() when merging
+// accesses to adjacent addresses.
+#if !defined(RSI_MEM_BATCH_MAX_LEN)
+#define RSI_MEM_BATCH_MAX_LEN RSI_HAL_MAX_WR_BUFF_LEN
+#endif
+// Stack buffer of rsi_mem_access_batch() through which adjacent accesses with buffers not
+// adjacent in host memory are merged, typically register sequences. 0 merges adjacent buffers only.
+#if !defined(RSI_MEM_BATCH_BOUNCE_LEN)
+#define RSI_MEM_BATCH_BOUNCE_LEN 64
+#endif
+
+// Bitmap of rsi_pkt_pool_class_t pools which may be created lock free. Lock free pool is a single
+// producer/single consumer ring, so only BT common, BT classic and BLE pools qualify: one command is
+// in flight per protocol, allocated by the task issuing it and freed by the driver task. WLAN data,
+// WLAN management and common pools are allocated by several tasks at once, and RX packets loaned to
+// sockets are freed by application tasks.
+#define RSI_PKT_POOL_LOCK_FREE_CLASSES 0x38
+
+// Bitmap of rsi_pkt_pool_class_t pools created lock free by default, see RSI_PKT_POOL_LOCK_FREE_CLASSES
+#if !defined(RSI_PKT_POOL_LOCK_FREE_MAP)
+#define RSI_PKT_POOL_LOCK_FREE_MAP 0
+#endif
+#if (RSI_PKT_POOL_LOCK_FREE_MAP & ~RSI_PKT_POOL_LOCK_FREE_CLASSES)
+#error "RSI_PKT_POOL_LOCK_FREE_MAP has pools not in RSI_PKT_POOL_LOCK_FREE_CLASSES"
+#endif
+
+// Maximum number of consecutive blocking rsi_select() calls answered from socket readiness already
+// known on host, the next one queries module so that other sockets get reported too. 0 disables.
+#if !defined(RSI_SELECT_CACHE_MAX_HITS)
+#define RSI_SELECT_CACHE_MAX_HITS 8
+#endif
+
+// Module select timeout used by rsi_epoll_wait() waiting forever, the select is re-issued when it expires
+#if !defined(RSI_EPOLL_SELECT_TIMEOUT_MS)
+#define RSI_EPOLL_SELECT_TIMEOUT_MS 1000
+#endif
+
+// Size of host receive ring of each synchronous TCP socket, taken from driver memory. Data requested from
+// module is read ahead into the ring and rsi_recv() is served from it. 0 disables the ring.
+#if !defined(RSI_SOCKET_RX_RING_SIZE)
+#define RSI_SOCKET_RX_RING_SIZE 0
+#endif
+
+// Number of data packets of rsi_send_large_data_async()/rsi_send_large_data_sync() kept queued to module per
+// socket, limited by free data TX packets and by module buffers on sockets with TCP ACK indication.
+// 0 sends one chunk at a time and waits for it to be written before sending the next.
+#if !defined(RSI_SOCKET_TX_PIPELINE_DEPTH)
+#define RSI_SOCKET_TX_PIPELINE_DEPTH 0
+#endif
+#if (RSI_SOCKET_TX_PIPELINE_DEPTH && (defined(RSI_UART_INTERFACE) || defined(RSI_M4_INTERFACE)))
+#error "RSI_SOCKET_TX_PIPELINE_DEPTH is not supported on UART and M4 interfaces"
+#endif
+
+// rsi_sendmmsg() on UDP sockets queues all datagrams to module and waits once for all of them to be written.
+// 0 sends one datagram at a time and waits for it to be written before sending the next.
+#if !defined(RSI_SOCKET_TX_BATCH)
+#if (defined(RSI_UART_INTERFACE) || defined(RSI_M4_INTERFACE))
+#define RSI_SOCKET_TX_BATCH 0
+#else
+#define RSI_SOCKET_TX_BATCH 1
+#endif
+#endif
+#if (RSI_SOCKET_TX_BATCH && (defined(RSI_UART_INTERFACE) || defined(RSI_M4_INTERFACE)))
+#error "RSI_SOCKET_TX_BATCH is not supported on UART and M4 interfaces"
+#endif
 
 extern rsi_driver_cb_t *rsi_driver_cb;
 /******************************************************
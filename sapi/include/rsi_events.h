@@ -68,6 +68,18 @@
 
 #endif
 
+// Default priority of an event, events of higher priority are dispatched first
+#define RSI_EVENT_PRIORITY_DEFAULT 0
+
+// Index of lowest set event bit in a non-zero event map
+#if (defined(__GNUC__) || defined(__clang__))
+#define RSI_EVENT_CTZ(event_map) ((uint32_t)__builtin_ctz(event_map))
+#elif (defined(__CC_ARM) && (defined(__TARGET_ARCH_7_M) || defined(__TARGET_ARCH_7E_M)))
+#define RSI_EVENT_CTZ(event_map) ((uint32_t)__clz(__rbit(event_map)))
+#else
+#define RSI_EVENT_CTZ(event_map) rsi_event_ctz(event_map)
+#endif
+
 /******************************************************
  * *                    Constants
  * ******************************************************/
@@ -96,6 +108,8 @@ typedef struct rsi_event_cb_s {
 
 uint16_t rsi_register_event(uint32_t event_id, void (*event_handler_ptr)(void));
 uint32_t rsi_find_event(uint32_t event_map);
+uint32_t rsi_event_ctz(uint32_t event_map);
+int32_t rsi_set_event_priority(uint32_t event_num, uint8_t priority);
 void rsi_set_event(uint32_t event_num);
 void rsi_clear_event(uint32_t event_num);
 void rsi_mask_event(uint32_t event_num);
@@ -104,6 +104,12 @@ void rsi_hal_set_gpio(uint8_t gpio_number);
 uint8_t rsi_hal_get_gpio(uint8_t gpio_number);
 void rsi_hal_clear_gpio(uint8_t gpio_number);
 int16_t rsi_spi_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode);
+int16_t rsi_spi_transfer_async(uint8_t *tx_buff,
+                               uint8_t *rx_buff,
+                               uint16_t transfer_length,
+                               uint8_t mode,
+                               void (*transfer_done)(void));
+void rsi_spi_transfer_abort(void);
 int16_t rsi_uart_send(uint8_t *ptrBuf, uint16_t bufLen);
 int16_t rsi_uart_recv(uint8_t *ptrBuf, uint16_t bufLen);
 int16_t rsi_com_port_send(uint8_t *ptrBuf, uint16_t bufLen);
@@ -24,6 +24,9 @@
 /******************************************************
  * *                      Macros
  * ******************************************************/
+// Received data packet is loaned to application and must not be freed by RX handler
+#define RSI_RX_PKT_LOANED 1
+
 #ifndef RSI_IPV6
 // flag bit to set IPV6
 #define RSI_IPV6 BIT(0)
@@ -850,6 +853,12 @@ void rsi_update_nwk_cmd_state_to_progress_state(void);
 void rsi_post_waiting_nwk_semaphore(void);
 int32_t rsi_driver_process_recv_data_non_rom(rsi_pkt_t *pkt);
 int32_t rsi_driver_send_data_non_rom(uint32_t sockID, uint8_t *buffer, uint32_t length, struct rsi_sockaddr *destAddr);
+rsi_pkt_t *rsi_driver_send_data_alloc(uint32_t sockID, uint32_t length, uint8_t **payload);
+rsi_pkt_t *rsi_driver_send_data_alloc_non_blocking(uint32_t sockID, uint32_t length, uint8_t **payload);
+int32_t rsi_driver_queue_pkt(uint32_t sockID, rsi_pkt_t *pkt, uint32_t length, struct rsi_sockaddr *destAddr);
+int32_t rsi_driver_send_pkt(uint32_t sockID, rsi_pkt_t *pkt, uint32_t length, struct rsi_sockaddr *destAddr);
+int32_t rsi_recv_pkt_release(rsi_pkt_t *pkt);
+uint8_t rsi_rx_loan_take(void);
 int32_t rsi_http_credentials(int8_t *username, int8_t *password);
 int32_t rsi_req_wireless_fwup(void);
 // MDNS-SD structure definations
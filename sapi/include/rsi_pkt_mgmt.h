@@ -23,6 +23,19 @@
 /******************************************************
  * *                      Macros
  * ******************************************************/
+// Packet pool watermark events
+#define RSI_PKT_POOL_LOW_WATERMARK  1
+#define RSI_PKT_POOL_HIGH_WATERMARK 2
+
+// Memory barrier ordering lock free packet pool ring slot and index accesses
+#ifndef RSI_PKT_POOL_MEMORY_BARRIER
+#if defined(__ICCARM__)
+#include <intrinsics.h>
+#define RSI_PKT_POOL_MEMORY_BARRIER() __DMB()
+#else
+#define RSI_PKT_POOL_MEMORY_BARRIER() __sync_synchronize()
+#endif
+#endif
 /******************************************************
  * *                    Constants
  * ******************************************************/
@@ -57,8 +70,39 @@ typedef struct rsi_pkt_pool_s {
 
   rsi_semaphore_handle_t pkt_sem;
 
+  // Available count at or below which low watermark is reported
+  uint16_t low_watermark;
+
+  // Available count at or above which high watermark is reported, after a low watermark
+  uint16_t high_watermark;
+
+  // Set while pool is below high watermark after reporting low watermark
+  uint8_t low_watermark_hit;
+
+  // Watermark callback, NULL if watermarks are not in use
+  void (*watermark_cb)(struct rsi_pkt_pool_s *pool_cb, uint8_t event, uint16_t avail);
+
+  // Set if pool is a lock free single producer/single consumer ring
+  uint8_t lock_free;
+
+  // Set by allocator blocked on empty lock free pool, cleared by free
+  volatile uint8_t ring_waiting;
+
+  // Lock free ring indices, packets are freed at head and allocated from tail
+  volatile uint16_t ring_head;
+  volatile uint16_t ring_tail;
+
 } rsi_pkt_pool_t;
 
+// frame segment used in scatter-gather frame write
+typedef struct rsi_frame_iovec_s {
+  // segment data pointer
+  uint8_t *buffer;
+
+  // segment length
+  uint16_t length;
+} rsi_frame_iovec_t;
+
 /******************************************************
  * *                    Structures
  * ******************************************************/
@@ -70,6 +114,17 @@ typedef struct rsi_pkt_pool_s {
  * ******************************************************/
 int32_t rsi_pkt_pool_init(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t total_size, uint32_t pkt_size);
 rsi_pkt_t *rsi_pkt_alloc(rsi_pkt_pool_t *pool_cb);
+rsi_pkt_t *rsi_pkt_alloc_non_blocking(rsi_pkt_pool_t *pool_cb);
 int32_t rsi_pkt_free(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt);
+int32_t rsi_pkt_pool_init_lock_free(rsi_pkt_pool_t *pool_cb, uint8_t *buffer, uint32_t total_size, uint32_t pkt_size);
+int32_t rsi_pkt_free_from_isr(rsi_pkt_pool_t *pool_cb, rsi_pkt_t *pkt);
 uint32_t rsi_is_pkt_available(rsi_pkt_pool_t *pool_cb);
+int32_t rsi_pkt_pool_set_watermarks(rsi_pkt_pool_t *pool_cb,
+                                    uint16_t low_watermark,
+                                    uint16_t high_watermark,
+                                    void (*watermark_cb)(rsi_pkt_pool_t *pool_cb, uint8_t event, uint16_t avail));
+int32_t rsi_pkt_attach_payload(rsi_pkt_t *pkt, uint8_t *buffer, uint16_t length);
+uint8_t rsi_pkt_detach_payload(rsi_pkt_t *pkt, rsi_frame_iovec_t *iov);
+void rsi_pkt_payload_written(rsi_pkt_t *pkt);
+void rsi_pkt_release_payload(rsi_pkt_t *pkt);
 #endif
@@ -20,6 +20,10 @@
 /******************************************************
  * *                      Macros
  * ******************************************************/
+// Number of event priority levels supported by the scheduler
+#ifndef RSI_SCHEDULER_NUM_PRIORITIES
+#define RSI_SCHEDULER_NUM_PRIORITIES 4
+#endif
 /******************************************************
  * *                    Constants
  * ******************************************************/
@@ -40,6 +44,9 @@ typedef struct rsi_scheduler_cb_s {
 
   // scheduler semaphore
   rsi_semaphore_handle_t scheduler_sem;
+
+  // Bitmap of events at each priority level, every event is in exactly one level
+  uint32_t priority_map[RSI_SCHEDULER_NUM_PRIORITIES];
 } rsi_scheduler_cb_t;
 
 /******************************************************
@@ -55,5 +62,6 @@ void rsi_scheduler_init(rsi_scheduler_cb_t *scheduler_cb);
 uint32_t rsi_get_event(rsi_scheduler_cb_t *scheduler_cb);
 void rsi_scheduler(rsi_scheduler_cb_t *scheduler_cb);
 uint32_t rsi_get_event_non_rom(rsi_scheduler_cb_t *scheduler_cb);
+void rsi_scheduler_dispatch(rsi_scheduler_cb_t *scheduler_cb, uint32_t event_map);
 
 #endif
@@ -51,9 +51,11 @@ int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf);
 int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf);
 int16_t rsi_reg_rd(uint8_t regAddr, uint8_t *dBuf);
 int16_t rsi_reg_wr(uint8_t regAddr, uint8_t *dBuf);
+void rsi_sdio_mem_window_hold(uint8_t hold);
 int32_t rsi_mcu_sdio_init(void);
 int16_t rsi_device_interrupt_status(uint8_t *int_status);
 int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloadparam, uint16_t size_param);
+int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt);
 int16_t rsi_frame_read(uint8_t *pkt_buffer);
 
 void smih_callback_handler(uint32_t event);
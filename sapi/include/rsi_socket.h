@@ -18,6 +18,8 @@
 #ifndef RSI__SOCKET_H
 #define RSI__SOCKET_H
 #include "rsi_os.h"
+#include "rsi_pkt_mgmt.h"
+#include "rsi_user.h"
 /******************************************************
  * *                      Macros
  * ******************************************************/
@@ -29,6 +31,17 @@
 #define RSI_FD_CLR(x, y)   rsi_fd_clr(x, y)
 #define RSI_FD_ISSET(x, y) rsi_fd_isset(x, y)
 
+// Epoll events
+#define RSI_EPOLLIN  0x001 /* Data to receive                                                        */
+#define RSI_EPOLLOUT 0x004 /* Space to send data                                                     */
+#define RSI_EPOLLERR 0x008 /* Error on socket, always reported                                       */
+#define RSI_EPOLLHUP 0x010 /* Connection terminated, always reported                                 */
+
+// Epoll control operations
+#define RSI_EPOLL_CTL_ADD 1 /* Register socket                                                       */
+#define RSI_EPOLL_CTL_DEL 2 /* Deregister socket                                                      */
+#define RSI_EPOLL_CTL_MOD 3 /* Change events of registered socket                                     */
+
 #define RSI_SOCKET_FEAT_SSL          BIT(0)
 #define RSI_SOCKET_FEAT_WEBS_SUPPORT BIT(1)
 #define RSI_HIGH_PERFORMANCE_SOCKET  BIT(7)
@@ -50,7 +63,18 @@
 #define RSI_LTCP_PRIMARY_SOCKET   1
 #define RSI_LTCP_SECONDARY_SOCKET 2
 
-#define BSD_MAX_SOCKETS           10
+// Max sockets module supports besides sockets accepted on LTCP sockets
+#define RSI_MODULE_MAX_SOCKETS 10
+
+// Limit of module socket IDs, which are bit positions of the 32-bit bitmaps exchanged with module
+#define RSI_MODULE_MAX_SOCKET_ID 32
+
+#if (RSI_NUMBER_OF_SOCKETS > RSI_MODULE_MAX_SOCKET_ID)
+#error "RSI_NUMBER_OF_SOCKETS exceeds the socket IDs module can report"
+#endif
+
+#define BSD_MAX_SOCKETS \
+  ((RSI_NUMBER_OF_SOCKETS > RSI_MODULE_MAX_SOCKETS) ? RSI_NUMBER_OF_SOCKETS : RSI_MODULE_MAX_SOCKETS)
 #define RSI_CLEAR_ALL_SOCKETS     0xEF
 #define RSI_LTCP_PORT_BASED_CLOSE 0xEE
 #ifdef FD_SETSIZE
@@ -117,6 +141,10 @@
 #define FIONBIO 0x5421 /* Enables socket non blocking option for the ioctl() command            */
 #endif
 
+/* Define receive flags. */
+#define MSG_PEEK     0x2  /* Return data without removing it, for sockets with host receive ring    */
+#define MSG_DONTWAIT 0x40 /* Return RSI_ERROR_EAGAIN instead of waiting, for this call only          */
+
 /* Define additional BSD socket errors. */
 
 /* From errno-base.h in /usr/include/asm-generic;  */
@@ -304,6 +332,9 @@
 #define SO_TCP_ACK_INDICATION       45             /* To enable tcp ack indication feature*/
 #define SO_CERT_INDEX               46             /* To enable set certificate index*/
 #define SO_TLS_SNI                  47             /* To Configure the TLS SNI extension */
+#define SO_NONBLOCK                 49             /* To make socket calls return instead of waiting */
+#define SO_SEND_CREDITS             50             /* To get send credits, struct rsi_send_credits */
+#define SO_SOCKET_STATS             51             /* To get or clear statistics, struct rsi_socket_stats */
 
 /*  This second set of socket options take the socket level (category) IPPROTO_IP. */
 
@@ -446,6 +477,45 @@ typedef struct
   int32_t fd_count; /* How many are SET?                                                                            */
 } rsi_fd_set;
 
+// Module socket ID bitmap of select request and response, layout is fixed by module
+typedef struct rsi_module_fd_set_s {
+  uint32_t fd_array[1]; /* Bit map of module socket IDs                                                           */
+  int32_t fd_count;     /* Number of set bits                                                                     */
+} rsi_module_fd_set_t;
+
+// User data returned with epoll events of a socket
+typedef union rsi_epoll_data_u {
+  void *ptr;
+  int32_t fd;
+  uint32_t u32;
+} rsi_epoll_data_t;
+
+struct rsi_epoll_event {
+  uint32_t events;       /* RSI_EPOLLIN, RSI_EPOLLOUT, RSI_EPOLLERR and RSI_EPOLLHUP bits               */
+  rsi_epoll_data_t data; /* User data given at registration                                          */
+};
+
+// Buffer of a scatter/gather list
+struct rsi_iovec {
+  void *iov_base;   /* Start of buffer                                                          */
+  uint32_t iov_len; /* Length of buffer in bytes                                                */
+};
+
+struct rsi_msghdr {
+  void *msg_name;               /* Address of remote peer, optional                               */
+  rsi_socklen_t msg_namelen;    /* Length of address in bytes                                     */
+  struct rsi_iovec *msg_iov;    /* Scatter/gather list of data                                    */
+  uint32_t msg_iovlen;          /* Number of entries in msg_iov                                   */
+  void *msg_control;            /* Ancillary data, not supported                                  */
+  rsi_socklen_t msg_controllen; /* Length of ancillary data, not supported                        */
+  int32_t msg_flags;            /* Flags of received message                                      */
+};
+
+struct rsi_mmsghdr {
+  struct rsi_msghdr msg_hdr; /* Message                                                                */
+  uint32_t msg_len;          /* Number of bytes sent for message                                        */
+};
+
 typedef struct BSD_SOCKET_SUSPEND_STRUCT {
   uint32_t bsd_socket_suspend_actual_flags;
   rsi_fd_set bsd_socket_suspend_read_fd_set;
@@ -482,6 +552,33 @@ struct rsi_sock_winsize {
   int32_t winsize; /* receive window size for TCP sockets   ; */
 };
 
+// Send credits of a socket, got using rsi_getsockopt() with SO_SEND_CREDITS
+struct rsi_send_credits {
+  uint32_t socket_credits;     /* Module buffers socket can still use, for SO_TCP_ACK_INDICATION sockets */
+  uint32_t socket_max_credits; /* Module buffers of socket, 0 if socket does not use TCP ACK indication */
+  uint32_t module_credits;     /* Frames written to module before buffer full is checked again          */
+  uint32_t module_buffer_full; /* 1 if module reported buffer full and TX waits for RX to be served     */
+};
+
+// Number of latency histogram buckets, bucket i counts latencies below 2^i ms, last bucket all longer ones
+#define RSI_SOCKET_STATS_HIST_BUCKETS 8
+
+// Statistics of a socket, got using rsi_getsockopt() with SO_SOCKET_STATS or rsi_socket_stats_get_all().
+// Latencies are sampled, one packet of a socket at a time.
+struct rsi_socket_stats {
+  uint32_t tx_bytes;       /* Data bytes queued to module                                             */
+  uint32_t tx_segments;    /* Data packets queued to module                                           */
+  uint32_t tx_completions; /* Data packets written to module                                          */
+  uint32_t tx_buffer_full; /* Data packets dropped on module buffer full, and sends short of buffers   */
+  uint32_t rx_bytes;       /* Data bytes received from module                                         */
+  uint32_t rx_segments;    /* Data packets received from module                                       */
+  uint32_t rx_wakeups;     /* Receive calls woken up after waiting for data                           */
+  uint32_t rx_dropped;     /* Received data bytes dropped as host receive ring was full               */
+  uint32_t wait_time_ms;   /* Time send and receive calls waited on socket semaphores                 */
+  uint32_t tx_latency_hist[RSI_SOCKET_STATS_HIST_BUCKETS]; /* Send queued to packet written to module   */
+  uint32_t rx_latency_hist[RSI_SOCKET_STATS_HIST_BUCKETS]; /* Data received to handed to application    */
+};
+
 typedef union rsi_ip_addr_u {
   uint8_t ipv4[4];
   uint8_t ipv6[16];
@@ -614,6 +711,22 @@ int32_t rsi_sendto(int32_t sockID,
                    struct rsi_sockaddr *destAddr,
                    int32_t destAddrLen);
 int32_t rsi_send(int32_t sockID, const int8_t *msg, int32_t msgLength, int32_t flags);
+int8_t *rsi_send_reserve(int32_t sockID, int32_t msgLength);
+int32_t rsi_send_commit(int32_t sockID, int32_t msgLength, int32_t flags);
+int32_t rsi_sendto_commit(int32_t sockID,
+                          int32_t msgLength,
+                          int32_t flags,
+                          struct rsi_sockaddr *destAddr,
+                          int32_t destAddrLen);
+void rsi_send_release(int32_t sockID);
+int32_t rsi_sendmsg(int32_t sockID, const struct rsi_msghdr *msg, int32_t flags);
+int32_t rsi_sendmmsg(int32_t sockID, struct rsi_mmsghdr *msgvec, uint32_t vlen, int32_t flags);
+int32_t rsi_recvmsg(int32_t sockID, struct rsi_msghdr *msg, int32_t flags);
+int32_t rsi_socket_set_recv_pkt_handler(int32_t sockID,
+                                        void (*handler)(int32_t sockID,
+                                                        rsi_pkt_t *pkt,
+                                                        uint16_t offset,
+                                                        uint16_t length));
 int32_t rsi_send_large_data_async(int32_t sockID,
                                   const int8_t *msg,
                                   int32_t msgLength,
@@ -627,6 +740,11 @@ int32_t rsi_select(int32_t nfds,
                    rsi_fd_set *exceptfds,
                    struct rsi_timeval *timeout,
                    void (*callback)(rsi_fd_set *fd_read, rsi_fd_set *fd_write, rsi_fd_set *fd_except, int32_t status));
+int32_t rsi_epoll_create(void);
+int32_t rsi_epoll_ctl(int32_t epfd, int32_t op, int32_t sockID, struct rsi_epoll_event *event);
+int32_t rsi_epoll_wait(int32_t epfd, struct rsi_epoll_event *events, int32_t maxevents, int32_t timeout_ms);
+int32_t rsi_epoll_close(int32_t epfd);
+int32_t rsi_socket_stats_get_all(struct rsi_socket_stats *stats, int32_t count);
 int32_t rsi_shutdown(int32_t sockID, int32_t how);
 int32_t rsi_socket_async(int32_t protocolFamily,
                          int32_t type,
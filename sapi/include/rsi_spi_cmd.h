@@ -242,6 +242,13 @@ void rsi_timer_interrupt_handler(void);
 int16_t rsi_send_c1c2(uint8_t c1, uint8_t c2);
 int16_t rsi_send_c3c4(uint8_t c3, uint8_t c4);
 int16_t rsi_spi_wait_start_token(uint32_t timeout, uint8_t mode);
+int16_t rsi_send_c1c2c3c4(uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4);
+int16_t rsi_spi_wait_start_token_prefetch(uint32_t timeout,
+                                          uint8_t mode,
+                                          uint16_t read_len,
+                                          uint8_t *prefetch,
+                                          uint8_t *prefetch_len);
+int16_t rsi_spi_read_prefetched(uint8_t *buf, uint16_t len, uint8_t mode, uint8_t *prefetch, uint8_t *prefetch_len);
 int16_t rsi_clear_interrupt(uint8_t interruptClear);
 int16_t rsi_mem_wr(uint32_t addr, uint16_t len, uint8_t *dBuf);
 int16_t rsi_mem_rd(uint32_t addr, uint16_t len, uint8_t *dBuf);
@@ -250,6 +257,7 @@ int16_t rsi_reg_rd2(uint8_t regAddr, uint16_t *dBuf);
 int16_t rsi_reg_wr(uint8_t regAddr, uint8_t *dBuf);
 int16_t rsi_pre_dsc_rd(uint8_t *dbuf);
 int16_t rsi_pkt_rd(uint8_t *pkt, uint16_t dummy_len, uint16_t total_len);
+int16_t rsi_spi_frame_prefix_rd(uint8_t *pkt_buffer);
 int16_t rsi_set_intr_mask(uint8_t interruptMask);
 int16_t rsi_spi_iface_init(void);
 void rsi_ulp_wakeup_init(void);
@@ -103,6 +103,12 @@
 #define RSI_QDNSTIMEOUT 6 * RSI_TICKS_PER_SECOND
 /*@ Start token timeout */
 #define RSI_START_TOKEN_TIMEOUT 10 * RSI_TICKS_PER_SECOND
+/*@ Asynchronous SPI transfer completion timeout, in ms */
+#define RSI_SPI_ASYNC_TIMEOUT 1000
+/*@ Time to take a completion posted just before an asynchronous SPI transfer is aborted, in ms */
+#define RSI_SPI_ASYNC_DRAIN_TIMEOUT 1
+/*@ Memory writes up to this length are sent along with their address in a single transfer */
+#define RSI_SPI_MEM_WR_INLINE_LEN 12
 /*@ Set Listen interval timeout */
 #define RSI_SLITIMEOUT 1 * RSI_TICKS_PER_SECOND
 /*@ Config Enable timeout */
@@ -180,4 +186,7 @@ extern int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloa
 extern int16_t rsi_frame_read(uint8_t *pkt_buffer);
 extern int16_t rsi_spi_frame_dsc_wr(rsi_frame_desc_t *uFrameDscFrame);
 extern int16_t rsi_spi_frame_data_wr(uint16_t bufLen, uint8_t *dBuf, uint16_t tbufLen, uint8_t *tBuf);
+extern int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt);
+extern int16_t rsi_spi_frame_data_writev(uint8_t *hBuf, uint16_t hbufLen, const rsi_frame_iovec_t *iov, uint8_t iovcnt);
+extern int16_t rsi_spi_bulk_transfer(uint8_t *tx_buff, uint8_t *rx_buff, uint16_t transfer_length, uint8_t mode);
 #endif
@@ -133,6 +133,7 @@ typedef struct rsi_linux_app_cb_s {
  * ******************************************************/
 extern rsi_linux_app_cb_t rsi_linux_app_cb;
 extern int16_t rsi_frame_write(rsi_frame_desc_t *uFrameDscFrame, uint8_t *payloadparam, uint16_t size_param);
+extern int16_t rsi_frame_writev(rsi_frame_desc_t *uFrameDscFrame, const rsi_frame_iovec_t *iov, uint8_t iovcnt);
 extern int16_t rsi_frame_read(uint8_t *pkt_buffer);
 extern int16_t rsi_uart_send(uint8_t *ptrBuf, uint16_t bufLen);
 extern int16_t rsi_uart_recv(uint8_t *ptrBuf, uint16_t bufLen);
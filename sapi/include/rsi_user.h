@@ -50,7 +50,7 @@
 //#define RSI_NUMBER_OF_LTCP_SOCKETS 2
 #define RSI_NUMBER_OF_LTCP_SOCKETS 0
 
-//! Default number of sockets supported,max 10 sockets are supported
+//! Default number of sockets supported, max 10 sockets plus RSI_NUMBER_OF_LTCP_SOCKETS and at most 32 in total
 //#define RSI_NUMBER_OF_SOCKETS (2 + RSI_NUMBER_OF_LTCP_SOCKETS)
 #define RSI_NUMBER_OF_SOCKETS (6 + RSI_NUMBER_OF_LTCP_SOCKETS)
 
@@ -58,9 +58,15 @@
 //#define RSI_NUMBER_OF_SELECTS 4
 #define RSI_NUMBER_OF_SELECTS (RSI_NUMBER_OF_SOCKETS)
 
+//! Number of epoll instances, each one uses a select while it waits on module
+#define RSI_NUMBER_OF_EPOLLS 1
+
 // Max packets in wlan control tx pool
 #define RSI_WLAN_TX_POOL_PKT_COUNT 1
 
+// Max packets in wlan data tx pool, 0 to allocate data frames from wlan control tx pool, rsi_send_reserve() needs it non-zero
+#define RSI_WLAN_DATA_TX_POOL_PKT_COUNT 0
+
 // Max packets in bt common control tx pool
 #define RSI_BT_COMMON_TX_POOL_PKT_COUNT 1
 
@@ -1220,9 +1220,9 @@ typedef struct rsi_req_socket_select_s {
   uint8_t num_fd;
   uint8_t select_id;
 
-  rsi_fd_set rsi_read_fds;
+  rsi_module_fd_set_t rsi_read_fds;
 
-  rsi_fd_set rsi_write_fds;
+  rsi_module_fd_set_t rsi_write_fds;
 
   struct rsi_timeval rsi_select_timeval;
 
@@ -1347,10 +1347,10 @@ typedef struct rsi_rsp_socket_select_s {
   uint8_t select_id;
 
   // readfd struct to store select info
-  rsi_fd_set rsi_read_fds;
+  rsi_module_fd_set_t rsi_read_fds;
 
   // readfd struct to store select info
-  rsi_fd_set rsi_write_fds;
+  rsi_module_fd_set_t rsi_write_fds;
 
   // readfd struct to store select info
   uint32_t socket_terminate_bitmap;
@@ -1836,6 +1836,8 @@ void rsi_check_wlan_buffer_full(rsi_pkt_t *pkt);
 void rsi_check_common_buffer_full(rsi_pkt_t *pkt);
 
 void rsi_wlan_packet_transfer_done(rsi_pkt_t *pkt);
+rsi_pkt_pool_t *rsi_wlan_get_data_tx_pool(void);
+void rsi_wlan_free_tx_pkt(rsi_pkt_t *pkt);
 int8_t rsi_wlan_cb_init(rsi_wlan_cb_t *wlan_cb);
 uint32_t rsi_check_wlan_state(void);
 int32_t rsi_wlan_radio_init(void);
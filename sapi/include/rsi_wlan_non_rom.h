@@ -101,6 +101,45 @@ typedef struct rsi_socket_info_non_rom_s {
   uint8_t more_rx_data_pending;
 #endif
   uint32_t tos;
+  // Data packet reserved by rsi_send_reserve(), sent by rsi_send_commit()/rsi_sendto_commit()
+  rsi_pkt_t *reserved_pkt;
+  // Maximum data length of reserved packet
+  uint16_t reserved_length;
+  // Receive handler taking ownership of received data packets, returned using rsi_recv_pkt_release()
+  void (*recv_pkt_handler)(int32_t sockID, rsi_pkt_t *pkt, uint16_t offset, uint16_t length);
+  // Module reported data to receive, cleared when next receive request is sent
+  uint8_t ready_to_read;
+  // Last data send completed, cleared on buffer full or once reported by rsi_select()
+  uint8_t ready_to_write;
+  // Read position and number of bytes held in host receive ring
+  uint16_t rx_ring_head;
+  uint16_t rx_ring_count;
+  // Packets of large data send or rsi_sendmmsg() batch queued to module and not yet written
+  uint8_t tx_pipe_count;
+  // Send is waited for by rsi_send_large_data_sync() or rsi_sendmmsg() instead of reported by callback
+  uint8_t tx_pipe_sync;
+  // Status of send and number of its bytes written to module, in order
+  int16_t tx_pipe_status;
+  int32_t tx_pipe_done;
+  // Scatter list of rsi_recvmsg() taking received data in place of receive buffer, and its filled length
+  const struct rsi_iovec *recv_iov;
+  uint32_t recv_iovlen;
+  uint32_t recv_iov_offset;
+  // Calls on socket return RSI_ERROR_EAGAIN instead of waiting for data, buffers or connection, set by SO_NONBLOCK
+  uint8_t non_blocking;
+  // Connect or accept request of non-blocking socket is sent to module and not answered yet
+  uint8_t connect_pending;
+  // Socket of non-blocking accept on this listening socket waiting for connection, plus 1, 0 if none
+  uint8_t accept_pending_id;
+  // Statistics, and tick and sequence number of sampled send packet and received data
+  struct rsi_socket_stats stats;
+  uint32_t tx_sample_tick;
+  uint32_t tx_queued_seq;
+  uint32_t tx_sample_seq;
+  uint32_t tx_done_seq;
+  uint8_t tx_sample_pending;
+  uint8_t rx_sample_pending;
+  uint32_t rx_sample_tick;
 } rsi_socket_info_non_rom_t;
 
 typedef struct rsi_tls_tlv_s {
@@ -403,6 +442,20 @@ int32_t rsi_socket_listen(int32_t sockID, int32_t backlog);
 int32_t rsi_socket_shutdown(int32_t sockID, int32_t how);
 int32_t rsi_select_get_status(int32_t selectid);
 void rsi_select_set_status(int32_t status, int32_t selectid);
+int32_t rsi_select_known_ready(int32_t nfds, rsi_fd_set *readfds, rsi_fd_set *writefds);
+uint8_t rsi_socket_known_ready_to_read(int32_t sockID);
+void rsi_epoll_notify(int32_t sockID, uint32_t events);
+void rsi_socket_stats_tx_queued(int32_t sockID, uint32_t length);
+void rsi_socket_stats_tx_done(int32_t sockID, uint8_t written);
+void rsi_socket_stats_rx_arrival(int32_t sockID, uint32_t length);
+void rsi_socket_stats_rx_delivered(int32_t sockID);
+void rsi_socket_stats_wait_done(int32_t sockID, uint32_t start_tick);
+void rsi_epoll_forget_socket(int32_t sockID);
+uint8_t rsi_socket_rx_ring_used(int32_t sockID);
+uint32_t rsi_socket_rx_ring_write(int32_t sockID, const uint8_t *data, uint32_t length);
+int32_t rsi_socket_rx_ring_read(int32_t sockID, int8_t *buffer, int32_t length, int32_t flags);
+uint8_t rsi_socket_tx_pipe_done(rsi_pkt_t *pkt, int32_t status);
+void rsi_socket_recv_copy(int32_t sockID, uint8_t *buffer, uint32_t offset, const uint8_t *data, uint32_t length);
 int32_t rsi_socket_bind(int32_t sockID, struct rsi_sockaddr *localAddress, int32_t addressLength);
 void rsi_clear_sockets_non_rom(int32_t sockID);
 int32_t rsi_sendto_async_non_rom(int32_t sockID,
@@ -421,6 +474,7 @@ void rsi_wlan_socket_set_status(int32_t status, int32_t sockID);
 int32_t rsi_wlan_socket_get_status(int32_t sockID);
 int32_t rsi_get_socket_id(uint32_t src_port, uint32_t dst_port);
 int32_t rsi_application_socket_descriptor(int32_t sock_id);
+void rsi_socket_set_module_id(int32_t sockID, int32_t sock_id);
 void rsi_post_waiting_socket_semaphore(int32_t sockID);
 int32_t rsi_wlan_req_radio(uint8_t enable);
 int32_t rsi_wlan_radio_deinit(void);
@@ -441,7 +495,7 @@ void rsi_set_event_from_isr_non_rom(uint32_t event_num);
 void rsi_unmask_event_from_isr_non_rom(uint32_t event_num);
 void rsi_unmask_event_non_rom(uint32_t event_num);
 #endif
-int rsi_getsockopt(int32_t sockID, int level, int option_name, const void *option_value, rsi_socklen_t option_len);
+int rsi_getsockopt(int32_t sockID, int level, int option_name, void *option_value, rsi_socklen_t option_len);
 int32_t rsi_tcp_window_update(uint32_t sockID, uint32_t new_size_bytes);
 typedef enum {
   RSI_SOCKET_SELECT_STATE_INIT = 0,
@@ -471,6 +525,18 @@ typedef struct rsi_wlan_cb_non_rom_s {
   uint16_t ps_listen_interval;
 
   uint8_t emb_mqtt_ssl_enable;
+
+  // WLAN data tx packet pool, used instead of wlan_tx_pool for RSI_WLAN_DATA_Q frames when not empty
+  rsi_pkt_pool_t wlan_data_tx_pool;
+
+  // Consecutive rsi_select() calls answered from host readiness without querying module
+  uint8_t select_cache_hits;
+
+  // Set while select issued by a non-blocking receive to learn readiness of its socket is pending
+  volatile uint8_t recv_probe_pending;
+
+  // Application socket descriptor of each module socket ID, checked against socket pool before use
+  uint8_t socket_id_map[RSI_MODULE_MAX_SOCKET_ID];
 } rsi_wlan_cb_non_rom_t;
 
 /*===================================================*/
@@ -525,4 +591,35 @@ typedef struct rsi_socket_select_info_s {
   void (*sock_select_callback)(rsi_fd_set *fd_read, rsi_fd_set *fd_write, rsi_fd_set *fd_except, int32_t status);
 
 } rsi_socket_select_info_t;
+
+// epoll instance
+typedef struct rsi_socket_epoll_info_s {
+  uint8_t in_use;
+
+  // Module select issued for this instance is not answered yet
+  uint8_t select_pending;
+
+  // Select used while select_pending is set
+  uint8_t select_id;
+
+  // A task waits on epoll_sem
+  uint8_t waiting;
+
+  // Events of interest per socket, 0 if socket is not registered
+  uint32_t interest[RSI_NUMBER_OF_SOCKETS];
+
+  // User data per socket
+  rsi_epoll_data_t data[RSI_NUMBER_OF_SOCKETS];
+
+  // Events ready per socket and not yet returned
+  uint32_t ready[RSI_NUMBER_OF_SOCKETS];
+
+  // Sockets with ready events in order of arrival, a socket is queued once
+  uint8_t ready_ring[RSI_NUMBER_OF_SOCKETS];
+  uint8_t ready_head;
+  uint8_t ready_count;
+
+  // Posted when an event is queued or module select is answered while a task waits
+  rsi_semaphore_handle_t epoll_sem;
+} rsi_socket_epoll_info_t;
 #endif
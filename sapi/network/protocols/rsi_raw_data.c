@@ -41,7 +41,7 @@ int32_t rsi_send_raw_data(uint8_t *buffer, uint32_t length)
   }
 
   // Allocate packet to send data
-  pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
+  pkt = rsi_pkt_alloc(rsi_wlan_get_data_tx_pool());
 
   if (pkt == NULL) {
     // Return packet allocation failure error
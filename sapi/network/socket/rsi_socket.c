@@ -22,7 +22,13 @@
 // Socket information pool pointer
 rsi_socket_info_t *rsi_socket_pool;
 rsi_socket_info_non_rom_t *rsi_socket_pool_non_rom;
+// Host receive rings of sockets, RSI_SOCKET_RX_RING_SIZE bytes each rounded up to 4
+uint8_t *rsi_socket_rx_ring;
 extern rsi_socket_select_info_t *rsi_socket_select_info;
+extern rsi_socket_epoll_info_t *rsi_socket_epoll_info;
+static int32_t rsi_get_max_send_length(int32_t sockID);
+static uint8_t rsi_socket_dont_wait(int32_t sockID, int32_t flags);
+static void rsi_socket_recv_probe(int32_t sockID);
 
 /** @addtogroup NETWORK5
 * @{
@@ -39,7 +45,7 @@ extern rsi_socket_select_info_t *rsi_socket_select_info;
 
 int rsi_fd_isset(uint32_t fd, struct rsi_fd_set_s *fds_p)
 {
-  uint32_t mask = 1 << (fd % 32);
+  uint32_t mask = 1U << (fd % 32);
   return fds_p->fd_array[fd / 32] & mask;
 }
 /** @} */
@@ -57,7 +63,7 @@ int rsi_fd_isset(uint32_t fd, struct rsi_fd_set_s *fds_p)
 
 void rsi_set_fd(uint32_t fd, struct rsi_fd_set_s *fds_p)
 {
-  uint32_t mask = 1 << (fd % 32);
+  uint32_t mask = 1U << (fd % 32);
   fds_p->fd_array[fd / 32] |= mask;
 }
 /** @} */
@@ -75,7 +81,7 @@ void rsi_set_fd(uint32_t fd, struct rsi_fd_set_s *fds_p)
 
 void rsi_fd_clr(uint32_t fd, struct rsi_fd_set_s *fds_p)
 {
-  uint32_t mask = 1 << (fd % 32);
+  uint32_t mask = 1U << (fd % 32);
   fds_p->fd_array[fd / 32] &= ~mask;
 }
 /** @} */
@@ -195,7 +201,7 @@ int32_t rsi_bind(int32_t sockID, struct rsi_sockaddr *localAddress, int32_t addr
 */
 /*==============================================*/
 /**
- * @brief       Connect the socket to the specified remote address. This is a non-blocking API if socket_connect_response handler() is registered through rsi_wlan_register_callbacks(), otherwise it is a blocking API.
+ * @brief       Connect the socket to the specified remote address. This is a non-blocking API if socket_connect_response handler() is registered through rsi_wlan_register_callbacks(), otherwise it is a blocking API. On a TCP socket set with SO_NONBLOCK, it returns with RSI_ERROR_EINPROGRESS and completion is reported by a later call.
  * @pre         \ref rsi_socket() or \ref  rsi_bind()  API needs to be called before this API.
  * @param[in]   sockID         - Socket descriptor ID
  * @param[in]   remoteAddress  - Remote peer address. The format is compatible with BSD socket.
@@ -318,79 +324,108 @@ int32_t rsi_accept_non_rom(int32_t sockID, struct rsi_sockaddr *ClientAddress, i
 
   sock_info = &rsi_socket_pool[sockID];
 
-  // Check maximum backlogs count
-  if (sock_info->backlogs == sock_info->backlog_current_count) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_ENOBUFS, sockID);
+  if (rsi_socket_pool_non_rom[sockID].accept_pending_id) {
+    // Connection for earlier non-blocking accept
+    accept_sock_id = rsi_socket_pool_non_rom[sockID].accept_pending_id - 1;
+    if (rsi_socket_pool_non_rom[accept_sock_id].connect_pending) {
+      // Set error
+      rsi_wlan_socket_set_status(RSI_ERROR_EAGAIN, sockID);
 #ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_ENOBUFS);
+      rsi_set_os_errno(RSI_ERROR_EAGAIN);
 #endif
-    return RSI_SOCK_ERROR;
-  }
+      return RSI_SOCK_ERROR;
+    }
+    rsi_socket_pool_non_rom[sockID].accept_pending_id = 0;
+  } else {
+    // Check maximum backlogs count
+    if (sock_info->backlogs == sock_info->backlog_current_count) {
+      // Set error
+      rsi_wlan_socket_set_status(RSI_ERROR_ENOBUFS, sockID);
+#ifdef RSI_WITH_OS
+      rsi_set_os_errno(RSI_ERROR_ENOBUFS);
+#endif
+      return RSI_SOCK_ERROR;
+    }
 
-  if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_LISTEN) {
-    // Create a new instance for socket
-    accept_sock_id = rsi_socket_async((sock_info->sock_type >> 4),
-                                      (sock_info->sock_type & 0xF),
-                                      (sock_info->sock_bitmap),
-                                      sock_info->sock_receive_callback);
+    if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_LISTEN) {
+      // Create a new instance for socket
+      accept_sock_id = rsi_socket_async((sock_info->sock_type >> 4),
+                                        (sock_info->sock_type & 0xF),
+                                        (sock_info->sock_bitmap),
+                                        sock_info->sock_receive_callback);
 
-    if ((accept_sock_id >= 0) && (accept_sock_id < NUMBER_OF_SOCKETS)) {
+      if ((accept_sock_id >= 0) && (accept_sock_id < NUMBER_OF_SOCKETS)) {
 
-      // Set socket as secondary socket
-      rsi_socket_pool[accept_sock_id].ltcp_socket_type = RSI_LTCP_SECONDARY_SOCKET;
+        // Set socket as secondary socket
+        rsi_socket_pool[accept_sock_id].ltcp_socket_type = RSI_LTCP_SECONDARY_SOCKET;
 
-      // Save local port number
-      rsi_socket_pool[accept_sock_id].source_port = rsi_socket_pool[sockID].source_port;
-    } else {
-      // Set error
-      rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
+        // Save local port number
+        rsi_socket_pool[accept_sock_id].source_port = rsi_socket_pool[sockID].source_port;
+      } else {
+        // Set error
+        rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
 #ifdef RSI_WITH_OS
-      rsi_set_os_errno(RSI_ERROR_EBADF);
+        rsi_set_os_errno(RSI_ERROR_EBADF);
 #endif
-      return RSI_SOCK_ERROR;
+        return RSI_SOCK_ERROR;
+      }
     }
-  }
 
-  // Allocate packet
-  pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
-  if (pkt == NULL) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_PKT_ALLOCATION_FAILURE, sockID);
+    // Allocate packet
+    pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
+    if (pkt == NULL) {
+      // Set error
+      rsi_wlan_socket_set_status(RSI_ERROR_PKT_ALLOCATION_FAILURE, sockID);
 #ifdef RSI_WITH_OS
-    status = rsi_get_error(sockID);
-    rsi_set_os_errno(status);
+      status = rsi_get_error(sockID);
+      rsi_set_os_errno(status);
 #endif
-    return RSI_SOCK_ERROR;
-  }
+      return RSI_SOCK_ERROR;
+    }
 
-  // Send socket accept command
-  accept = (rsi_req_socket_accept_t *)pkt->data;
+    // Send socket accept command
+    accept = (rsi_req_socket_accept_t *)pkt->data;
 
-  // Fill socket descriptor
-  accept->socket_id = rsi_socket_pool[sockID].sock_id;
+    // Fill socket descriptor
+    accept->socket_id = rsi_socket_pool[sockID].sock_id;
 
-  // Fill local port number
-  rsi_uint16_to_2bytes(accept->source_port, rsi_socket_pool[sockID].source_port);
+    // Fill local port number
+    rsi_uint16_to_2bytes(accept->source_port, rsi_socket_pool[sockID].source_port);
 
+    if (rsi_socket_pool_non_rom[sockID].non_blocking) {
+      // Connection is taken by a later call once module reports it
+      rsi_socket_pool_non_rom[accept_sock_id].connect_pending = 1;
+      rsi_socket_pool_non_rom[sockID].accept_pending_id       = accept_sock_id + 1;
+    } else {
 #ifndef RSI_SOCK_SEM_BITMAP
-  rsi_socket_pool_non_rom[accept_sock_id].socket_wait_bitmap |= BIT(0);
+      rsi_socket_pool_non_rom[accept_sock_id].socket_wait_bitmap |= BIT(0);
 #endif
+    }
 
-  // Send socket accept command
-  status = RSI_DRIVER_WLAN_SEND_CMD(RSI_WLAN_REQ_SOCKET_ACCEPT, pkt);
+    // Send socket accept command
+    status = RSI_DRIVER_WLAN_SEND_CMD(RSI_WLAN_REQ_SOCKET_ACCEPT, pkt);
 
-  // Wait on socket semaphore
-  status =
-    rsi_wait_on_socket_semaphore(&rsi_socket_pool_non_rom[accept_sock_id].socket_sem, RSI_ACCEPT_RESPONSE_WAIT_TIME);
-  if (status != RSI_ERROR_NONE) {
-    // Get WLAN/network command response status
-    rsi_wlan_socket_set_status(status, sockID);
+    if (rsi_socket_pool_non_rom[sockID].non_blocking) {
+      // Set error
+      rsi_wlan_socket_set_status(RSI_ERROR_EAGAIN, sockID);
 #ifdef RSI_WITH_OS
-    status = rsi_get_error(sockID);
-    rsi_set_os_errno(status);
+      rsi_set_os_errno(RSI_ERROR_EAGAIN);
 #endif
-    return RSI_SOCK_ERROR;
+      return RSI_SOCK_ERROR;
+    }
+
+    // Wait on socket semaphore
+    status =
+      rsi_wait_on_socket_semaphore(&rsi_socket_pool_non_rom[accept_sock_id].socket_sem, RSI_ACCEPT_RESPONSE_WAIT_TIME);
+    if (status != RSI_ERROR_NONE) {
+      // Get WLAN/network command response status
+      rsi_wlan_socket_set_status(status, sockID);
+#ifdef RSI_WITH_OS
+      status = rsi_get_error(sockID);
+      rsi_set_os_errno(status);
+#endif
+      return RSI_SOCK_ERROR;
+    }
   }
   // Get WLAN/network command response status
   status = rsi_wlan_socket_get_status(accept_sock_id);
@@ -464,7 +499,7 @@ int32_t rsi_accept_non_rom(int32_t sockID, struct rsi_sockaddr *ClientAddress, i
 */
 /*==============================================*/
 /**
- * @brief      Accept the connection request from the remote peer. This API extracts the connection request from the queue of pending connections on listening socket and accepts it. This is a blocking API.
+ * @brief      Accept the connection request from the remote peer. This API extracts the connection request from the queue of pending connections on listening socket and accepts it. This is a blocking API, unless SO_NONBLOCK is set on the listening socket, then it returns with RSI_ERROR_EAGAIN until a connection is accepted.
  * @pre        \ref rsi_listen()/ API needs to be called before this API.
  * @param[in]  sockID          - Socket descriptor
  * @param[in]  ClientAddress   - Remote peer address
@@ -532,10 +567,15 @@ int32_t rsi_recv_large_data_sync(int32_t sockID,
   }
   do {
     rsi_socket_pool_non_rom[sockID].more_rx_data_pending = 0;
+    rsi_socket_pool_non_rom[sockID].recv_iov_offset      = offset;
     chunk_size                                           = MIN(maximum_length, rem_len);
     status = rsi_socket_recvfrom(sockID, buffer + offset, chunk_size, flags, fromAddr, fromAddrLen);
     if (status < 0) {
       status = rsi_wlan_socket_get_status(sockID);
+      if ((offset == 0) && (status == RSI_ERROR_EAGAIN)) {
+        // Nothing to receive on non-blocking socket, error is already set
+        return RSI_SOCK_ERROR;
+      }
 #ifdef RSI_WITH_OS
       status = rsi_get_error(sockID);
       rsi_set_os_errno(status);
@@ -561,7 +601,8 @@ int32_t rsi_recv_large_data_sync(int32_t sockID,
  * @param[in]  sockID         - Socket descriptor
  * @param[in]  buffer         - Pointer to buffer to hold receive data
  * @param[in]  buffersize     - Size of the buffer supplied
- * @param[in]  flags          - Reserved
+ * @param[in]  flags          - MSG_PEEK to return data without removing it, on TCP sockets with host receive ring, MSG_DONTWAIT to return RSI_ERROR_EAGAIN when no data is known on host, module is then asked in the background
+ *                              (RSI_SOCKET_RX_RING_SIZE) only
  * @param[in]  fromAddr       - Address of remote peer, from where current packet was received
  * @param[in]  fromAddrLen    - Pointer that contains remote peer address (fromAddr) length
  * @return     Positive Value - Success, returns the number of bytes received successfully \n
@@ -580,7 +621,8 @@ int32_t rsi_recvfrom(int32_t sockID,
                      int32_t *fromAddrLen)
 {
 #ifdef RSI_PROCESS_MAX_RX_DATA
-  if (rsi_socket_pool[sockID].sock_type & SOCK_STREAM) {
+  // Host receive ring reads ahead on its own
+  if ((rsi_socket_pool[sockID].sock_type & SOCK_STREAM) && !rsi_socket_rx_ring_used(sockID)) {
     return rsi_recv_large_data_sync(sockID, buffer, buffersize, flags, fromAddr, fromAddrLen);
   } else {
     return rsi_socket_recvfrom(sockID, buffer, buffersize, flags, fromAddr, fromAddrLen);
@@ -604,7 +646,8 @@ int32_t rsi_recvfrom(int32_t sockID,
  * @param[in]  sockID         - Socket descriptor ID
  * @param[in]  rcvBuffer      - Pointer to the buffer to hold the data received from the remote peer
  * @param[in]  bufferLength   - Length of the buffer
- * @param[in]  flags          - Reserved
+ * @param[in]  flags          - MSG_PEEK to return data without removing it, on TCP sockets with host receive ring, MSG_DONTWAIT to return RSI_ERROR_EAGAIN when no data is known on host, module is then asked in the background
+ *                              (RSI_SOCKET_RX_RING_SIZE) only
  * @return     Positive Value - Success, returns the number of bytes received successfully \n
  *             Negative Value - Failure
  *             zero           - Socket close error
@@ -616,7 +659,8 @@ int32_t rsi_recv(int32_t sockID, void *rcvBuffer, int32_t bufferLength, int32_t
 {
   int32_t fromAddrLen = 0;
 #ifdef RSI_PROCESS_MAX_RX_DATA
-  if (rsi_socket_pool[sockID].sock_type & SOCK_STREAM) {
+  // Host receive ring reads ahead on its own
+  if ((rsi_socket_pool[sockID].sock_type & SOCK_STREAM) && !rsi_socket_rx_ring_used(sockID)) {
     return rsi_recv_large_data_sync(sockID, rcvBuffer, bufferLength, flags, NULL, &fromAddrLen);
   } else {
     return rsi_socket_recvfrom(sockID, rcvBuffer, bufferLength, flags, NULL, &fromAddrLen);
@@ -633,7 +677,7 @@ int32_t rsi_recv(int32_t sockID, void *rcvBuffer, int32_t bufferLength, int32_t
 */
 /*==============================================*/
 /**
- * @brief       Send data to specific remote peer on a given socket synchronously. This is a blocking API.
+ * @brief       Send data to specific remote peer on a given socket synchronously. This is a blocking API, on SO_TCP_ACK_INDICATION sockets it also waits for module buffers of the socket.
  * @pre         For tcp_client, \ref  rsi_connect() \n
  *              For tcp_server, \ref  rsi_listen() and  \ref  rsi_accept()/ API needs to be called before this API. \n
  *              For udp_server \ref rsi_bind()  API needs to be called before this API. \n
@@ -641,7 +685,7 @@ int32_t rsi_recv(int32_t sockID, void *rcvBuffer, int32_t bufferLength, int32_t
  * @param[in]   sockID         - Socket descriptor ID
  * @param[in]   msg            - Pointer to data buffer containing data to send to remote peer
  * @param[in]   msgLength      - Length of the buffer
- * @param[in]   flags          - Reserved
+ * @param[in]   flags          - MSG_DONTWAIT to return RSI_ERROR_EAGAIN when module has no buffers
  * @param[in]   destAddr       - Address of the remote peer to send data
  * @param[in]   destAddrLen    - Length of the address in bytes
  * @return	    Positive Value - Success, returns the number of bytes sent successfully \n
@@ -700,12 +744,12 @@ int32_t rsi_sendto_async(int32_t sockID,
 */
 /*==============================================*/
 /**
- * @brief      Send data to remote peer on a given socket synchronously. This is a blocking API.
+ * @brief      Send data to remote peer on a given socket synchronously. This is a blocking API, on SO_TCP_ACK_INDICATION sockets it also waits for module buffers of the socket.
  * @pre    \ref rsi_connect()/ \ref rsi_accept() API needs to be called before this API.
  * @param[in]  sockID         - Socket descriptor ID
  * @param[in]  msg            - Pointer to the buffer containing data to send to the remote peer
  * @param[in]  msgLength      - Length of the buffer
- * @param[in]  flags          - Reserved
+ * @param[in]  flags          - MSG_DONTWAIT to return RSI_ERROR_EAGAIN when module has no buffers
  * @return     Positive Value - Success, returns the number of bytes sent successfully \n
  *             Negative Value - Failure \n
  *             Zero Value     - Socket close error
@@ -748,6 +792,278 @@ void rsi_reset_per_socket_info(int32_t sockID)
   rsi_sock_info_non_rom_p->rsi_sock_data_tx_done_cb = NULL;
 }
 
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+/*==============================================*/
+/**
+ * @brief      Start large data send on a given socket. Data is queued to module from socket event.
+ * @param[in]  sockID                   - Socket descriptor ID
+ * @param[in]  msg                      - Pointer to data that needs to be sent to remote peer
+ * @param[in]  msgLength                - Length of data to send
+ * @param[in]  flags                    - Reserved
+ * @param[in]  rsi_sock_data_tx_done_cb - Callback called once all data is written to module or send fails
+ * @param[in]  sync                     - 1 if completion is waited for by rsi_send_large_data_sync()
+ * @return     Zero                     - Success \n
+ *             Negative Value           - Failure
+ *
+ */
+/// @private
+static int32_t rsi_socket_tx_pipe_start(int32_t sockID,
+                                        const int8_t *msg,
+                                        int32_t msgLength,
+                                        int32_t flags,
+                                        void (*rsi_sock_data_tx_done_cb)(int32_t sockID,
+                                                                         int16_t status,
+                                                                         uint16_t total_data_sent),
+                                        uint8_t sync)
+{
+  rsi_reg_flags_t cs_flags;
+  rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
+
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+
+  // Check if the socket is already doing data transfer or its previous packets are not written yet
+  if ((rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID)) || (rsi_sock_info_non_rom_p->tx_pipe_count != 0)) {
+    RSI_CRITICAL_SECTION_EXIT(cs_flags);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EEXIST);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+
+  rsi_sock_info_non_rom_p->rsi_sock_data_tx_done_cb = rsi_sock_data_tx_done_cb;
+  rsi_sock_info_non_rom_p->buffer                   = (int8_t *)msg;
+  rsi_sock_info_non_rom_p->flags                    = flags;
+  rsi_sock_info_non_rom_p->offset                   = 0;
+  rsi_sock_info_non_rom_p->rem_len                  = (msgLength > 0) ? msgLength : 0;
+  rsi_sock_info_non_rom_p->tx_pipe_done             = 0;
+  rsi_sock_info_non_rom_p->tx_pipe_status           = RSI_SUCCESS;
+  rsi_sock_info_non_rom_p->tx_pipe_sync             = sync;
+  rsi_wlan_cb_non_rom->socket_bitmap |= BIT(sockID);
+
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
+
+  // Set the socket event
+  rsi_set_event(RSI_SOCKET_EVENT);
+
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @brief      Stop large data send on a given socket, if it is not completed yet
+ * @param[in]  sockID - Socket descriptor ID
+ * @return     1      - Send is stopped \n
+ *             0      - Send is already completed
+ *
+ */
+/// @private
+static uint8_t rsi_socket_tx_pipe_stop(int32_t sockID)
+{
+  rsi_reg_flags_t cs_flags;
+  uint8_t stopped = 0;
+
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+  if (rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID)) {
+    rsi_reset_per_socket_info(sockID);
+    stopped = 1;
+  }
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
+
+  return stopped;
+}
+
+/*==============================================*/
+/**
+ * @brief      Queue next chunks of large data send to module without waiting for them to be written, up to
+ *             RSI_SOCKET_TX_PIPELINE_DEPTH packets. Stops early if no data TX packet is free or, on sockets with
+ *             TCP ACK indication, module has no buffers left for the socket. Socket event is set again when a
+ *             packet is written or module frees buffers.
+ * @param[in]  sockID - Socket descriptor ID
+ * @return     Void
+ *
+ */
+/// @private
+static void rsi_socket_tx_pipe_fill(int32_t sockID)
+{
+  struct rsi_sockaddr_in fromAddr4;
+  struct rsi_sockaddr_in6 fromAddr6;
+  struct rsi_sockaddr *destAddr;
+  uint16_t chunk_size;
+  uint8_t buffers_required;
+  uint8_t *payload;
+  rsi_pkt_t *pkt;
+  rsi_socket_info_t *sock_info                       = &rsi_socket_pool[sockID];
+  rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
+  int32_t maximum_length                             = rsi_get_max_send_length(sockID);
+
+  if ((sock_info->sock_type >> 4) == AF_INET) {
+    fromAddr4.sin_family = AF_INET;
+    fromAddr4.sin_port   = sock_info->destination_port;
+    memcpy(&fromAddr4.sin_addr.s_addr, sock_info->destination_ip_addr.ipv4, RSI_IPV4_ADDRESS_LENGTH);
+    destAddr = (struct rsi_sockaddr *)&fromAddr4;
+  } else {
+    fromAddr6.sin6_family = AF_INET6;
+    fromAddr6.sin6_port   = sock_info->destination_port;
+    memcpy(fromAddr6.sin6_addr._S6_un._S6_u8, sock_info->destination_ip_addr.ipv6, RSI_IPV6_ADDRESS_LENGTH);
+    destAddr = (struct rsi_sockaddr *)&fromAddr6;
+  }
+
+  while ((rsi_sock_info_non_rom_p->rem_len != 0)
+         && (rsi_sock_info_non_rom_p->tx_pipe_count < RSI_SOCKET_TX_PIPELINE_DEPTH)) {
+    if ((sock_info->sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION)
+        && (sock_info->current_available_buffer_count == 0)) {
+      break;
+    }
+
+    chunk_size = MIN(maximum_length, rsi_sock_info_non_rom_p->rem_len);
+    // Driver must not block, filling goes on when a written packet is freed
+    pkt = rsi_driver_send_data_alloc_non_blocking(sockID, chunk_size, &payload);
+    if (pkt == NULL) {
+      break;
+    }
+
+    if (sock_info->sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION) {
+      // Calculate buffers required for sending this length
+      buffers_required = calculate_buffers_required(sock_info->sock_type, chunk_size);
+      if (buffers_required > sock_info->current_available_buffer_count) {
+        // Calculate length can be sent with available buffers
+        chunk_size                                = global_cb_p->rom_apis_p->ROM_WL_calculate_length_to_send(global_cb_p,
+                                                                                              sock_info->sock_type,
+                                                                                              sock_info->current_available_buffer_count);
+        sock_info->current_available_buffer_count = 0;
+      } else {
+        sock_info->current_available_buffer_count -= buffers_required;
+      }
+    }
+
+    memcpy(payload, rsi_sock_info_non_rom_p->buffer + rsi_sock_info_non_rom_p->offset, chunk_size);
+
+    rsi_sock_info_non_rom_p->tx_pipe_count++;
+    if (rsi_driver_queue_pkt(sockID, pkt, chunk_size, destAddr) != RSI_SUCCESS) {
+      rsi_sock_info_non_rom_p->tx_pipe_count--;
+      rsi_sock_info_non_rom_p->tx_pipe_status = rsi_wlan_socket_get_status(sockID);
+      break;
+    }
+    rsi_sock_info_non_rom_p->offset += chunk_size;
+    rsi_sock_info_non_rom_p->rem_len -= chunk_size;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Queue more data of large data send of a given socket, and report the send once all its
+ *             packets are written to module or it fails
+ * @param[in]  sockID - Socket descriptor ID
+ * @return     Void
+ *
+ */
+/// @private
+static void rsi_socket_tx_pipe_service(int32_t sockID)
+{
+  rsi_reg_flags_t cs_flags;
+  uint8_t sync;
+  rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
+  void (*rsi_sock_data_tx_done_cb)(int32_t sockID, int16_t status, uint16_t total_data_sent) =
+    rsi_sock_info_non_rom_p->rsi_sock_data_tx_done_cb;
+
+  if (rsi_sock_info_non_rom_p->tx_pipe_status == RSI_SUCCESS) {
+    rsi_socket_tx_pipe_fill(sockID);
+  }
+
+  // Wait for queued packets, and for free packets or module buffers if data is left
+  if ((rsi_sock_info_non_rom_p->tx_pipe_count != 0)
+      || ((rsi_sock_info_non_rom_p->rem_len != 0) && (rsi_sock_info_non_rom_p->tx_pipe_status == RSI_SUCCESS))) {
+    return;
+  }
+
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+  sync     = rsi_sock_info_non_rom_p->tx_pipe_sync;
+  rsi_reset_per_socket_info(sockID);
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
+
+  if (sync) {
+#ifndef RSI_SOCK_SEM_BITMAP
+    rsi_sock_info_non_rom_p->socket_wait_bitmap &= ~BIT(2);
+#endif
+    rsi_semaphore_post(&rsi_sock_info_non_rom_p->sock_send_sem);
+  } else if (rsi_sock_data_tx_done_cb != NULL) {
+    rsi_sock_data_tx_done_cb(sockID,
+                             rsi_sock_info_non_rom_p->tx_pipe_status,
+                             (uint16_t)rsi_sock_info_non_rom_p->tx_pipe_done);
+  }
+}
+
+#endif
+
+#if (RSI_SOCKET_TX_PIPELINE_DEPTH || RSI_SOCKET_TX_BATCH)
+/*==============================================*/
+/**
+ * @brief      Account a data packet written to module, or dropped on buffer full, if it belongs to a large
+ *             data send or to a batch send of \ref rsi_sendmmsg()
+ * @param[in]  pkt    - Data packet
+ * @param[in]  status - RSI_SUCCESS if packet is written to module, error otherwise
+ * @return     1      - Packet belongs to large data send or batch send \n
+ *             0      - Packet is sent otherwise
+ *
+ */
+/// @private
+uint8_t rsi_socket_tx_pipe_done(rsi_pkt_t *pkt, int32_t status)
+{
+  rsi_req_socket_send_t *send = (rsi_req_socket_send_t *)pkt->data;
+  rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p;
+  rsi_reg_flags_t cs_flags;
+  uint8_t batch_done = 0;
+  int32_t sockID;
+
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+  // A packet is free again, large data sends waiting for one can continue
+  if (rsi_wlan_cb_non_rom->socket_bitmap) {
+    rsi_set_event(RSI_SOCKET_EVENT);
+  }
+#endif
+
+  sockID = rsi_get_application_socket_descriptor(send->socket_id[0]);
+  if ((sockID < 0) || (sockID >= NUMBER_OF_SOCKETS)) {
+    return 0;
+  }
+  rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
+
+  // Other sends on the socket are refused while its large data send or batch send packets are queued
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+  if (rsi_sock_info_non_rom_p->tx_pipe_count == 0) {
+    RSI_CRITICAL_SECTION_EXIT(cs_flags);
+    return 0;
+  }
+  rsi_sock_info_non_rom_p->tx_pipe_count--;
+
+  // Packets are written in order, so data after a failed packet is not counted
+  if (rsi_sock_info_non_rom_p->tx_pipe_status == RSI_SUCCESS) {
+    if (status == RSI_SUCCESS) {
+      rsi_sock_info_non_rom_p->tx_pipe_done += rsi_bytes2R_to_uint16(send->length);
+    } else {
+      rsi_sock_info_non_rom_p->tx_pipe_status = status;
+    }
+  }
+
+  // Large data send is reported from socket event, batch send is woken up here
+  if ((rsi_sock_info_non_rom_p->tx_pipe_count == 0) && rsi_sock_info_non_rom_p->tx_pipe_sync
+      && !(rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID))) {
+    rsi_sock_info_non_rom_p->tx_pipe_sync = 0;
+    batch_done                            = 1;
+  }
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
+
+  if (batch_done) {
+#ifndef RSI_SOCK_SEM_BITMAP
+    rsi_sock_info_non_rom_p->socket_wait_bitmap &= ~BIT(2);
+#endif
+    rsi_semaphore_post(&rsi_sock_info_non_rom_p->sock_send_sem);
+  }
+
+  return 1;
+}
+#endif
+
 /*==============================================*/
 /**
  * @brief      Send large data on a given socket synchronously.
@@ -764,11 +1080,16 @@ void rsi_reset_per_socket_info(int32_t sockID)
 int32_t rsi_send_large_data_sync(int32_t sockID, const int8_t *msg, int32_t msgLength, int32_t flags)
 {
   int32_t status         = 0;
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+  int32_t sent                                       = 0;
+  rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
+#else
   int32_t chunk_size     = 0;
   int32_t rem_len        = msgLength;
   int32_t offset         = 0;
   int8_t *buffer         = (int8_t *)msg;
   int32_t maximum_length = 0;
+#endif
 
   if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
     // Set error
@@ -778,6 +1099,35 @@ int32_t rsi_send_large_data_sync(int32_t sockID, const int8_t *msg, int32_t msgL
 #endif
     return RSI_SOCK_ERROR;
   }
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+  if (rsi_socket_tx_pipe_start(sockID, msg, msgLength, flags, NULL, 1) != RSI_SUCCESS) {
+    return RSI_SOCK_ERROR;
+  }
+  // Semaphore is also signalled by TCP ACK indications, so wait till the send is completed
+  while (rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID)) {
+    sent = rsi_sock_info_non_rom_p->tx_pipe_done;
+#ifndef RSI_SOCK_SEM_BITMAP
+    rsi_sock_info_non_rom_p->socket_wait_bitmap |= BIT(2);
+#endif
+    if (rsi_semaphore_wait(&rsi_sock_info_non_rom_p->sock_send_sem, RSI_SEND_DATA_RESPONSE_WAIT_TIME)
+        == RSI_ERROR_NONE) {
+      continue;
+    }
+    // Keep waiting as long as data is being written to module
+    if ((rsi_sock_info_non_rom_p->tx_pipe_done == sent) && rsi_socket_tx_pipe_stop(sockID)) {
+      rsi_sock_info_non_rom_p->tx_pipe_status = RSI_ERROR_RESPONSE_TIMEOUT;
+    }
+  }
+  status = rsi_sock_info_non_rom_p->tx_pipe_status;
+  if (status != RSI_SUCCESS) {
+    rsi_wlan_socket_set_status(status, sockID);
+#ifdef RSI_WITH_OS
+    status = rsi_get_error(sockID);
+    rsi_set_os_errno(status);
+#endif
+  }
+  return rsi_sock_info_non_rom_p->tx_pipe_done;
+#else
   // Find maximum limit based on the protocol
   if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM) {
     // If it is a UDP socket
@@ -812,6 +1162,7 @@ int32_t rsi_send_large_data_sync(int32_t sockID, const int8_t *msg, int32_t msgL
     }
   }
   return offset;
+#endif
 }
 
 /*==============================================*/
@@ -869,7 +1220,8 @@ void rsi_chunk_data_tx_done_cb(int32_t sockID, const uint16_t length)
       rsi_set_os_errno(status);
 #endif
       total_data_sent = rsi_sock_info_non_rom_p->offset;
-      if (status != RSI_TX_BUFFER_FULL) {
+      // Chunk is sent again on next socket event while module buffers are full or not acknowledged yet
+      if ((status != RSI_TX_BUFFER_FULL) && (rsi_wlan_socket_get_status(sockID) != RSI_ERROR_ENOBUFS)) {
         if (rsi_sock_info_non_rom_p->rsi_sock_data_tx_done_cb != NULL) {
           rsi_sock_info_non_rom_p->rsi_sock_data_tx_done_cb(sockID, status, total_data_sent);
         }
@@ -912,6 +1264,9 @@ void rsi_chunk_data_tx_done_cb(int32_t sockID, const uint16_t length)
  * @param[out] total_data_sent          - Total length of data sent
  * @return     Zero                     - Success, number of bytes sent successfully \n
  *             Negative Value           - Failure
+ * @note       If RSI_SOCKET_TX_PIPELINE_DEPTH is set, up to that many chunks are queued to module at a time and
+ *             the callback is called once all data is written to module or the send fails. Several sockets can
+ *             send large data at the same time.
  *
  */
 
@@ -923,10 +1278,12 @@ int32_t rsi_send_large_data_async(int32_t sockID,
                                                                    int16_t status,
                                                                    uint16_t total_data_sent))
 {
+#if !RSI_SOCKET_TX_PIPELINE_DEPTH
   int32_t status                                     = 0;
   uint16_t chunk_size                                = 0;
   rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
   int32_t maximum_length                             = 0;
+#endif
 
   if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
     // Set error
@@ -944,6 +1301,9 @@ int32_t rsi_send_large_data_async(int32_t sockID,
     return RSI_SOCK_ERROR;
   }
 
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+  return rsi_socket_tx_pipe_start(sockID, msg, msgLength, flags, rsi_sock_data_tx_done_cb, 0);
+#else
   // Find maximum limit based on the protocol
   if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM) {
     // If it is a UDP socket
@@ -986,6 +1346,7 @@ int32_t rsi_send_large_data_async(int32_t sockID,
   }
 
   return RSI_SUCCESS;
+#endif
 }
 
 /*==============================================*/
@@ -1022,6 +1383,17 @@ void rsi_socket_event_handler(void)
 {
   int32_t sockID = 0;
 
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+  // Clear the event first, so that packets written while serving the sockets set it again
+  rsi_clear_event(RSI_SOCKET_EVENT);
+
+  // Serve large data sends of all sockets
+  for (sockID = 0; sockID < RSI_NUMBER_OF_SOCKETS; sockID++) {
+    if (rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID)) {
+      rsi_socket_tx_pipe_service(sockID);
+    }
+  }
+#else
   if (rsi_wlan_cb_non_rom->socket_bitmap) {
     sockID = rsi_find_socket_data_pending(rsi_wlan_cb_non_rom->socket_bitmap);
 
@@ -1029,6 +1401,7 @@ void rsi_socket_event_handler(void)
   } else {
     rsi_clear_event(RSI_SOCKET_EVENT);
   }
+#endif
 }
 /** @} */
 
@@ -1080,6 +1453,7 @@ int32_t rsi_send_async(int32_t sockID,
  */
 int32_t rsi_shutdown(int32_t sockID, int32_t how)
 {
+  rsi_epoll_forget_socket(sockID);
   return rsi_socket_shutdown(sockID, how);
 }
 /** @} */
@@ -1366,6 +1740,18 @@ int rsi_setsockopt(int32_t sockID, int level, int option_name, const void *optio
     return RSI_SUCCESS;
   }
 
+  // For non-blocking mode, calls return RSI_ERROR_EAGAIN instead of waiting
+  if (option_name == SO_NONBLOCK) {
+    rsi_socket_pool_non_rom[sockID].non_blocking = (*(uint32_t *)option_value) ? 1 : 0;
+    return RSI_SUCCESS;
+  }
+
+  // Clear statistics, latency sample in progress is kept
+  if (option_name == SO_SOCKET_STATS) {
+    memset(&rsi_socket_pool_non_rom[sockID].stats, 0, sizeof(struct rsi_socket_stats));
+    return RSI_SUCCESS;
+  }
+
   if ((option_name != SO_RCVTIMEO) || (level != SOL_SOCKET)) {
     rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
 #ifdef RSI_WITH_OS
@@ -1417,20 +1803,20 @@ int rsi_setsockopt(int32_t sockID, int level, int option_name, const void *optio
  * @param[in]    sockID         - Socket descriptor ID
  * @param[in]    level          - Set the socket option, take the socket level
  * @param[in]    option_name    - Provide the name of the ID
- * @param[in]    option_value   - Value of the parameter
+ * @param[out]   option_value   - Value of the parameter, struct rsi_send_credits for SO_SEND_CREDITS,
+ *                                struct rsi_socket_stats for SO_SOCKET_STATS
  * @param[in]    option_len     - Length of the parameter
  * @return       Zero           - Success \n
  *               Negative Value - Failure
  */
 
-int rsi_getsockopt(int32_t sockID, int level, int option_name, const void *option_value, rsi_socklen_t option_len)
+int rsi_getsockopt(int32_t sockID, int level, int option_name, void *option_value, rsi_socklen_t option_len)
 {
-  UNUSED_PARAMETER(level);        //Added to resolve compilation warning, value is unchanged
-  UNUSED_PARAMETER(option_value); //Added to resolve compilation warning, value is unchanged
-  UNUSED_PARAMETER(option_len);   //Added to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(level); //Added to resolve compilation warning, value is unchanged
 #ifdef RSI_WITH_OS
   int32_t status = 0;
 #endif
+  struct rsi_send_credits *credits = NULL;
 
 #ifdef SOCKET_CLOSE_WAIT
   if (rsi_socket_pool[sockID].sock_state > RSI_SOCKET_STATE_INIT && rsi_socket_pool_non_rom[sockID].close_pending) {
@@ -1460,9 +1846,47 @@ int rsi_getsockopt(int32_t sockID, int level, int option_name, const void *optio
 #endif
     return RSI_SOCK_ERROR;
   }
-  if ((option_name == SO_CHECK_CONNECTED_STATE)) {
-    // If socket is in not created state
-    if (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED) {
+  if (option_name == SO_SEND_CREDITS) {
+    if ((option_value == NULL) || (option_len < sizeof(struct rsi_send_credits))) {
+      // Set error
+      rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
+#ifdef RSI_WITH_OS
+      rsi_set_os_errno(RSI_ERROR_EINVAL);
+#endif
+      return RSI_SOCK_ERROR;
+    }
+    credits = (struct rsi_send_credits *)option_value;
+    if (rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION) {
+      credits->socket_credits     = rsi_socket_pool[sockID].current_available_buffer_count;
+      credits->socket_max_credits = rsi_socket_pool[sockID].max_available_buffer_count;
+    } else {
+      credits->socket_credits     = 0;
+      credits->socket_max_credits = 0;
+    }
+    credits->module_credits     = rsi_driver_cb_non_rom->module_tx_credits;
+    credits->module_buffer_full = rsi_driver_cb_non_rom->tx_mask_event;
+  }
+  if (option_name == SO_SOCKET_STATS) {
+    if ((option_value == NULL) || (option_len < sizeof(struct rsi_socket_stats))) {
+      // Set error
+      rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
+#ifdef RSI_WITH_OS
+      rsi_set_os_errno(RSI_ERROR_EINVAL);
+#endif
+      return RSI_SOCK_ERROR;
+    }
+    memcpy(option_value, &rsi_socket_pool_non_rom[sockID].stats, sizeof(struct rsi_socket_stats));
+  }
+  if ((option_name == SO_CHECK_CONNECTED_STATE)) {
+    // Non-blocking connect is still in progress
+    if (rsi_socket_pool_non_rom[sockID].connect_pending) {
+#ifdef RSI_WITH_OS
+      rsi_set_os_errno(RSI_ERROR_EINPROGRESS);
+#endif
+      return RSI_SOCK_ERROR;
+    }
+    // If socket is in not created state
+    if (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED) {
       // Set error
       rsi_wlan_socket_get_status(sockID);
 #ifdef RSI_WITH_OS
@@ -1521,6 +1945,9 @@ int32_t rsi_select(int32_t nfds,
   int8_t index       = 0;
   int i, read_count = 0, write_count = 0;
   int32_t rsi_select_response_wait_time = 0;
+  int32_t known_count                   = 0;
+  rsi_fd_set known_readfds, known_writefds;
+  struct rsi_timeval no_wait = { 0, 0 };
 #ifdef SOCKET_CLOSE_WAIT
   rsi_fd_set rfds, wfds;
   RSI_FD_ZERO(&rfds);
@@ -1540,11 +1967,11 @@ int32_t rsi_select(int32_t nfds,
 
 #ifdef SOCKET_CLOSE_WAIT
         if (rsi_socket_pool_non_rom[index].close_pending) {
-          if ((readfds != NULL) && (readfds->fd_array[0]) & BIT(index)) {
+          if ((readfds != NULL) && RSI_FD_ISSET(index, readfds)) {
             read_count += 1;
             RSI_FD_SET(index, &rfds);
           }
-          if ((writefds != NULL) && (writefds->fd_array[0]) & BIT(index)) {
+          if ((writefds != NULL) && RSI_FD_ISSET(index, writefds)) {
             write_count += 1;
             RSI_FD_SET(index, &wfds);
           }
@@ -1552,8 +1979,7 @@ int32_t rsi_select(int32_t nfds,
 #endif
 
         if (readfds != NULL) {
-          if (((readfds->fd_array[0]) & BIT(index))
-              && (rsi_socket_pool[index].sock_state < RSI_SOCKET_STATE_CONNECTED)) {
+          if (RSI_FD_ISSET(index, readfds) && (rsi_socket_pool[index].sock_state < RSI_SOCKET_STATE_CONNECTED)) {
             RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
 #ifdef RSI_WITH_OS
             rsi_set_os_errno(RSI_ERROR_EBADF);
@@ -1562,7 +1988,7 @@ int32_t rsi_select(int32_t nfds,
           }
         }
         if (writefds != NULL) {
-          if (((writefds->fd_array[0]) & BIT(index))
+          if (RSI_FD_ISSET(index, writefds)
               && ((rsi_socket_pool[index].sock_state < RSI_SOCKET_STATE_CONNECTED)
                   && (!rsi_socket_pool_non_rom[index].sock_non_block))) {
             RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
@@ -1576,15 +2002,48 @@ int32_t rsi_select(int32_t nfds,
 #ifdef SOCKET_CLOSE_WAIT
       if (read_count + write_count) {
         if (readfds != NULL) {
-          readfds->fd_array[0] = rfds.fd_array[0];
+          memcpy(readfds->fd_array, rfds.fd_array, sizeof(rfds.fd_array));
         }
         if (writefds != NULL) {
-          writefds->fd_array[0] = wfds.fd_array[0];
+          memcpy(writefds->fd_array, wfds.fd_array, sizeof(wfds.fd_array));
         }
         RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
         return read_count + write_count;
       }
 #endif
+      // Return sockets already known to be ready without querying module. Once in a while module is queried
+      // without waiting, so that other sockets get reported too.
+      if (callback == NULL) {
+        RSI_FD_ZERO(&known_readfds);
+        RSI_FD_ZERO(&known_writefds);
+        if (readfds != NULL) {
+          known_readfds = *readfds;
+        }
+        if (writefds != NULL) {
+          known_writefds = *writefds;
+        }
+        known_count = rsi_select_known_ready(nfds,
+                                             (readfds != NULL) ? &known_readfds : NULL,
+                                             (writefds != NULL) ? &known_writefds : NULL);
+        if ((known_count > 0) && (rsi_wlan_cb_non_rom->select_cache_hits < RSI_SELECT_CACHE_MAX_HITS)) {
+          rsi_wlan_cb_non_rom->select_cache_hits++;
+          if (readfds != NULL) {
+            *readfds = known_readfds;
+          }
+          if (writefds != NULL) {
+            *writefds = known_writefds;
+          }
+          if (exceptfds != NULL) {
+            RSI_FD_ZERO(exceptfds);
+          }
+          RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+          return known_count;
+        }
+        if (known_count > 0) {
+          timeout = &no_wait;
+        }
+      }
+      rsi_wlan_cb_non_rom->select_cache_hits = 0;
       memset(&rsi_socket_select_info[i], 0, sizeof(rsi_socket_select_info_t));
       if (!callback) {
         status = rsi_semaphore_create(&rsi_socket_select_info[i].select_sem, 0);
@@ -1614,13 +2073,13 @@ int32_t rsi_select(int32_t nfds,
       // Update bitmap with the sock ids
       for (index = 0; index < nfds; index++) {
         if (readfds != NULL) {
-          if ((readfds->fd_array[0]) & BIT(index)) {
+          if (RSI_FD_ISSET(index, readfds)) {
             socket_desc = rsi_socket_pool[index].sock_id;
             read_select_bitmap |= BIT(socket_desc);
           }
         }
         if (writefds != NULL) {
-          if ((writefds->fd_array[0]) & BIT(index)) {
+          if (RSI_FD_ISSET(index, writefds)) {
             socket_desc = rsi_socket_pool[index].sock_id;
             write_select_bitmap |= BIT(socket_desc);
           }
@@ -1698,6 +2157,17 @@ int32_t rsi_select(int32_t nfds,
   }
   status = rsi_select_get_status(i);
   if (status == RSI_SUCCESS) {
+    // Module does not know about data already on host
+    for (index = 0; (known_count > 0) && (index < nfds); index++) {
+      if ((readfds != NULL) && RSI_FD_ISSET(index, &known_readfds) && !RSI_FD_ISSET(index, readfds)) {
+        RSI_FD_SET(index, readfds);
+        readfds->fd_count++;
+      }
+      if ((writefds != NULL) && RSI_FD_ISSET(index, &known_writefds) && !RSI_FD_ISSET(index, writefds)) {
+        RSI_FD_SET(index, writefds);
+        writefds->fd_count++;
+      }
+    }
     if (readfds != NULL) {
       // Return value of count
       read_count = readfds->fd_count;
@@ -2068,6 +2538,7 @@ int32_t rsi_socket_create_async(int32_t sockID, int32_t type, int32_t backlog)
   rsi_pkt_t *pkt = NULL;
   rsi_req_socket_t *socket_create;
   int32_t status = 0;
+  uint8_t nonblock_connect;
 
   rsi_driver_cb_t *rsi_driver_cb     = global_cb_p->rsi_driver_cb;
   rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
@@ -2202,7 +2673,12 @@ int32_t rsi_socket_create_async(int32_t sockID, int32_t type, int32_t backlog)
     socket_create->tcp_retry_transmit_timer = rsi_socket_pool_non_rom[sockID].tcp_retry_transmit_timer;
   }
 
-  if (!(rsi_wlan_cb_non_rom->callback_list.socket_connect_response_handler != NULL)) {
+  // Non-blocking TCP client does not wait for connection, response completes it later
+  nonblock_connect = ((type == RSI_SOCKET_TCP_CLIENT) && rsi_socket_pool_non_rom[sockID].non_blocking);
+  if (nonblock_connect) {
+    rsi_socket_pool_non_rom[sockID].connect_pending = 1;
+    rsi_wlan_socket_set_status(RSI_ERROR_EINPROGRESS, sockID);
+  } else if (!(rsi_wlan_cb_non_rom->callback_list.socket_connect_response_handler != NULL)) {
 #ifndef RSI_SOCK_SEM_BITMAP
     rsi_socket_pool_non_rom[sockID].socket_wait_bitmap |= BIT(0);
 #endif
@@ -2217,7 +2693,9 @@ int32_t rsi_socket_create_async(int32_t sockID, int32_t type, int32_t backlog)
   }
   // Send socket create command
   status = RSI_DRIVER_WLAN_SEND_CMD(RSI_WLAN_REQ_SOCKET_CREATE, pkt);
-  if (rsi_wlan_cb_non_rom->callback_list.socket_connect_response_handler != NULL) {
+  if (nonblock_connect) {
+    status = RSI_ERROR_EINPROGRESS;
+  } else if (rsi_wlan_cb_non_rom->callback_list.socket_connect_response_handler != NULL) {
     // In case of ssl certificate bypass connect behaves as asynchronous cmd for ssl sockets
     rsi_wlan_socket_set_status(RSI_SUCCESS, sockID);
   } else {
@@ -2497,6 +2975,7 @@ int32_t rsi_socket_async_non_rom(int32_t protocolFamily,
       }
 #endif
       memset(&rsi_socket_pool_non_rom[i], 0, sizeof(rsi_socket_info_non_rom_t));
+      rsi_epoll_forget_socket(i);
 
       status = rsi_semaphore_create(&rsi_socket_pool_non_rom[i].socket_sem, 0);
       if (status != RSI_ERROR_NONE) {
@@ -2529,6 +3008,9 @@ int32_t rsi_socket_async_non_rom(int32_t protocolFamily,
       // Set protocol type
       rsi_socket_pool[i].sock_type |= (protocolFamily << 4);
 
+      // No receive packet handler till one is set
+      rsi_socket_pool_non_rom[i].recv_pkt_handler = NULL;
+
       if (callback) {
         // Set socket asynchronous receive callback
         rsi_socket_pool[i].sock_receive_callback = callback;
@@ -2674,6 +3156,21 @@ int32_t rsi_socket_connect(int32_t sockID, struct rsi_sockaddr *remoteAddress, i
     return RSI_SOCK_ERROR;
   }
 
+  // Non-blocking TCP connect is repeated to find out whether it is complete
+  if (rsi_socket_pool_non_rom[sockID].non_blocking && ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)) {
+    if (rsi_socket_pool_non_rom[sockID].connect_pending) {
+      status = RSI_ERROR_EALREADY;
+    } else if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_CONNECTED) {
+      status = RSI_ERROR_EISCONN;
+    }
+    if (status != RSI_SUCCESS) {
+#ifdef RSI_WITH_OS
+      rsi_set_os_errno(status);
+#endif
+      return RSI_SOCK_ERROR;
+    }
+  }
+
   // Acquire mutex lock
   RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
 
@@ -2702,6 +3199,13 @@ int32_t rsi_socket_connect(int32_t sockID, struct rsi_sockaddr *remoteAddress, i
     status = rsi_socket_create_async(sockID, RSI_SOCKET_LUDP, 0);
   }
 
+  if (status == RSI_ERROR_EINPROGRESS) {
+    // Connection of non-blocking socket is reported by rsi_epoll_wait() or by calling rsi_connect() again
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EINPROGRESS);
+#endif
+    return RSI_SOCK_ERROR;
+  }
   if (status != RSI_SUCCESS) {
     // Set error
     rsi_wlan_socket_set_status(status, sockID);
@@ -2741,14 +3245,17 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
                             struct rsi_sockaddr *fromAddr,
                             int32_t *fromAddrLen)
 {
-  UNUSED_PARAMETER(flags); // Added to resolve compilation warning, value is unchanged
-
   struct rsi_sockaddr_in peer4_address;
   struct rsi_sockaddr_in6 peer6_address;
   int32_t status                      = RSI_SUCCESS;
   int32_t rsi_read_response_wait_time = 0;
+  uint32_t wait_start;
 
   int32_t copy_length = 0;
+#if RSI_SOCKET_RX_RING_SIZE
+  int32_t buffer_length = buffersize;
+#endif
+  uint8_t rx_ring_used;
   rsi_req_socket_read_t *data_recv;
   rsi_pkt_t *pkt = NULL;
 
@@ -2796,14 +3303,33 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
     return RSI_SOCK_ERROR;
   }
 
-  if (rsi_socket_pool_non_rom[sockID].socket_terminate_indication) {
+  // Non-blocking receive waits only for data known on host. Otherwise module is asked in the background, so that
+  // a later call finds data module has.
+  if (rsi_socket_dont_wait(sockID, flags) && !rsi_socket_known_ready_to_read(sockID)) {
+    rsi_socket_recv_probe(sockID);
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EAGAIN, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EAGAIN);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+
+  rx_ring_used = rsi_socket_rx_ring_used(sockID);
+
+  // Data buffered before termination is received first
+  if (rsi_socket_pool_non_rom[sockID].socket_terminate_indication
+      && !(rx_ring_used && rsi_socket_pool_non_rom[sockID].rx_ring_count)) {
     rsi_socket_pool_non_rom[sockID].socket_terminate_indication = 0;
     return copy_length;
   }
   // Acquire mutex lock
   RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
 
-  if (global_cb_p->rx_buffer_mem_copy != 1) {
+  if (rx_ring_used) {
+    // Data is deposited in ring
+    sock_info->recv_buffer = NULL;
+  } else if (global_cb_p->rx_buffer_mem_copy != 1) {
     sock_info->recv_buffer = (uint8_t *)buffer;
 #ifdef RSI_PROCESS_MAX_RX_DATA
     if (rsi_socket_pool[sockID].sock_type & SOCK_STREAM) {
@@ -2816,7 +3342,8 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
 #endif
   }
   // If nothing is left
-  if (sock_info->sock_recv_available_length == 0 || global_cb_p->rx_buffer_mem_copy != 1) {
+  if (rx_ring_used ? (rsi_socket_pool_non_rom[sockID].rx_ring_count == 0)
+                   : (sock_info->sock_recv_available_length == 0 || global_cb_p->rx_buffer_mem_copy != 1)) {
     // Allocate packet
     pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
     if (pkt == NULL) {
@@ -2839,6 +3366,10 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
 
     // Fill socket ID
     data_recv->socket_id = sock_info->sock_id;
+    if (rx_ring_used) {
+      // Read ahead as much as ring holds
+      buffersize = RSI_SOCKET_RX_RING_SIZE;
+    }
 #ifdef RSI_PROCESS_MAX_RX_DATA
     if (rsi_socket_pool[sockID].sock_type & SOCK_STREAM) {
       if (buffersize > MAX_RX_DATA_LENGTH) {
@@ -2879,12 +3410,17 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
 #ifndef RSI_SOCK_SEM_BITMAP
     rsi_socket_pool_non_rom[sockID].socket_wait_bitmap |= BIT(1);
 #endif
+    // Data reported by module so far is consumed by this request
+    rsi_socket_pool_non_rom[sockID].ready_to_read = 0;
 
     // Send socket receive request command
     status = RSI_DRIVER_WLAN_SEND_CMD(RSI_WLAN_REQ_SOCKET_READ_DATA, pkt);
 
+    wait_start = rsi_hal_gettickcount();
     status =
       rsi_wait_on_socket_semaphore(&rsi_socket_pool_non_rom[sockID].sock_recv_sem, (rsi_read_response_wait_time));
+    rsi_socket_pool_non_rom[sockID].stats.rx_wakeups++;
+    rsi_socket_stats_wait_done(sockID, wait_start);
 
     /* Check if we need to invalidate the recv buffer pointer */
     if (global_cb_p->rx_buffer_mem_copy != 1) {
@@ -2919,9 +3455,18 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
         return 0;
       }
     }
+  } else {
+    // Release mutex lock
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
   }
 
+#if RSI_SOCKET_RX_RING_SIZE
+  if (rx_ring_used) {
+    copy_length = rsi_socket_rx_ring_read(sockID, buffer, buffer_length, flags);
+  } else if (global_cb_p->rx_buffer_mem_copy == 1) {
+#else
   if (global_cb_p->rx_buffer_mem_copy == 1) {
+#endif
     // Get minimum of requested length and available length
     if (buffersize > (int32_t)sock_info->sock_recv_available_length) {
       copy_length = sock_info->sock_recv_available_length;
@@ -2950,6 +3495,10 @@ int32_t rsi_socket_recvfrom(int32_t sockID,
     copy_length = sock_info->recv_buffer_length;
   }
 
+  if (copy_length > 0) {
+    rsi_socket_stats_rx_delivered(sockID);
+  }
+
   // If fromAddr is not NULL then copy the IP address
   if (fromAddr && (*fromAddrLen != 0)) {
     if ((sock_info->sock_type >> 4) == AF_INET) {
@@ -3408,6 +3957,19 @@ int32_t rsi_application_socket_descriptor(int32_t sock_id)
 
   rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
 
+  // Try the socket module ID was last assigned to, the pool is scanned only if it is not the one anymore
+  if ((sock_id >= 0) && (sock_id < RSI_MODULE_MAX_SOCKET_ID)) {
+    i = rsi_wlan_cb_non_rom->socket_id_map[sock_id];
+    if ((i < NUMBER_OF_SOCKETS) && (rsi_socket_pool[i].sock_id == sock_id)
+        && (rsi_socket_pool[i].sock_state == RSI_SOCKET_STATE_CONNECTED)
+#ifdef SOCKET_CLOSE_WAIT
+        && !(rsi_socket_pool_non_rom[i].close_pending)
+#endif
+    ) {
+      return i;
+    }
+  }
+
   for (i = 0; i < NUMBER_OF_SOCKETS; i++) {
     if (rsi_socket_pool[i].sock_id == sock_id && rsi_socket_pool[i].sock_state == RSI_SOCKET_STATE_CONNECTED
 #ifdef SOCKET_CLOSE_WAIT
@@ -3429,6 +3991,26 @@ int32_t rsi_application_socket_descriptor(int32_t sock_id)
 * @{
 */
 /*==============================================*/
+/**
+ * @brief       Save module socket descriptor of a socket and map it back to the socket. This is a non-blocking API.
+ * @param[in]   sockID  - Application socket descriptor ID
+ * @param[in]   sock_id - Module's socket descriptor ID
+ * @return      Void
+ *
+ */
+/// @private
+void rsi_socket_set_module_id(int32_t sockID, int32_t sock_id)
+{
+  rsi_socket_pool[sockID].sock_id = sock_id;
+  if ((sock_id >= 0) && (sock_id < RSI_MODULE_MAX_SOCKET_ID)) {
+    rsi_wlan_cb_non_rom->socket_id_map[sock_id] = (uint8_t)sockID;
+  }
+}
+/** @} */
+/** @addtogroup NETWORK5
+* @{
+*/
+/*==============================================*/
 /**
  * @brief       Return WLAN status. This is a non-blocking API.
  * @param[in]   sockID - Application socket ID 
@@ -3492,307 +4074,2117 @@ void rsi_select_set_status(int32_t status, int32_t selectid)
   rsi_wlan_set_status(status);
 #endif
 }
+
 /*==============================================*/
 /**
- * @brief      Send data on a given socket asynchronously
- * @param[in]  sockID                         - Socket descriptor ID
- * @param[in]  msg                            - Pointer to data that needs to be sent to remote peer
- * @param[in]  msgLength                      - Length of data to send
- * @param[in]  flags                          - Reserved
- * @param[in]  data_transfer_complete_handler - Pointer to callback function called after complete data transfer
- * @param[out] sockID                         - Socket Descriptor ID
- * @param[out] length                         - Number of bytes transfered
- * @return	Zero                           - Success \n
- *             Negative Value                 - Failure
- *
- *  @note        Refer to Error Codes section for the description of the above error codes  \ref error-codes.
+ * @brief       Check whether received data of a socket is buffered in its host receive ring. The ring is used by
+ *              synchronous TCP sockets when RSI_SOCKET_RX_RING_SIZE is not 0.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @return      1              - Socket uses host receive ring \n
+ *              0              - Data is received into the rsi_recv() buffer
  */
 /// @private
-int32_t rsi_send_async_non_rom(int32_t sockID,
-                               const int8_t *msg,
-                               int32_t msgLength,
-                               int32_t flags,
-                               void (*data_transfer_complete_handler)(int32_t sockID, uint16_t length))
+uint8_t rsi_socket_rx_ring_used(int32_t sockID)
 {
-  struct rsi_sockaddr_in fromAddr4;
-  struct rsi_sockaddr_in6 fromAddr6;
-  int32_t status                     = 0;
-  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
-
-  if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
-#ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EBADF);
-#endif
-    return RSI_SOCK_ERROR;
-  }
-  if ((rsi_socket_pool[sockID].sock_type >> 4) == AF_INET) {
+  rsi_socket_info_t *sock_info = &rsi_socket_pool[sockID];
 
-    // Set socket family for IPv4
-    fromAddr4.sin_family = AF_INET;
+  return (RSI_SOCKET_RX_RING_SIZE != 0) && (sock_info->sock_bitmap & RSI_SOCKET_FEAT_SYNCHRONOUS)
+         && ((sock_info->sock_type & 0xF) == SOCK_STREAM);
+}
 
-    // Set destination port
-    fromAddr4.sin_port = rsi_socket_pool[sockID].destination_port;
+#if RSI_SOCKET_RX_RING_SIZE
+/*==============================================*/
+/**
+ * @brief       Append received data to the host receive ring of a socket. Data that does not fit is dropped,
+ *              which does not happen as long as module sends no more than requested. A drop is counted in
+ *              rx_dropped of socket statistics and RSI_ERROR_ENOBUFS is set as socket status.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   data           - Received data
+ * @param[in]   length         - Received data length
+ * @return      Number of bytes stored
+ */
+/// @private
+uint32_t rsi_socket_rx_ring_write(int32_t sockID, const uint8_t *data, uint32_t length)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+  uint8_t *ring = rsi_socket_rx_ring + (sockID * ((RSI_SOCKET_RX_RING_SIZE + 3) & ~3));
+  rsi_reg_flags_t flags;
+  uint32_t tail;
+  uint32_t first;
+
+  if (length > (uint32_t)(RSI_SOCKET_RX_RING_SIZE - sock_info_non_rom->rx_ring_count)) {
+    sock_info_non_rom->stats.rx_dropped += length - (RSI_SOCKET_RX_RING_SIZE - sock_info_non_rom->rx_ring_count);
+    length = RSI_SOCKET_RX_RING_SIZE - sock_info_non_rom->rx_ring_count;
+    // Stream is broken, application has to know
+    rsi_wlan_socket_set_status(RSI_ERROR_ENOBUFS, sockID);
+  }
+  tail  = (sock_info_non_rom->rx_ring_head + sock_info_non_rom->rx_ring_count) % RSI_SOCKET_RX_RING_SIZE;
+  first = RSI_SOCKET_RX_RING_SIZE - tail;
+  if (first >= length) {
+    memcpy(&ring[tail], data, length);
+  } else {
+    memcpy(&ring[tail], data, first);
+    memcpy(ring, &data[first], length - first);
+  }
 
-    // Set destination IPv4 address
-    memcpy(&fromAddr4.sin_addr.s_addr, rsi_socket_pool[sockID].destination_ip_addr.ipv4, RSI_IPV4_ADDRESS_LENGTH);
+  // Reader only looks at bytes counted in
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  sock_info_non_rom->rx_ring_count += length;
+  RSI_CRITICAL_SECTION_EXIT(flags);
+  return length;
+}
 
-    status = rsi_sendto_async(sockID,
-                              (int8_t *)msg,
-                              msgLength,
-                              flags,
-                              (struct rsi_sockaddr *)&fromAddr4,
-                              sizeof(fromAddr4),
-                              data_transfer_complete_handler);
+/*==============================================*/
+/**
+ * @brief       Copy data out of the host receive ring of a socket.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[out]  buffer         - Buffer to copy data to
+ * @param[in]   length         - Size of buffer
+ * @param[in]   flags          - MSG_PEEK leaves the data in the ring
+ * @return      Number of bytes copied
+ */
+/// @private
+int32_t rsi_socket_rx_ring_read(int32_t sockID, int8_t *buffer, int32_t length, int32_t flags)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+  uint8_t *ring = rsi_socket_rx_ring + (sockID * ((RSI_SOCKET_RX_RING_SIZE + 3) & ~3));
+  rsi_reg_flags_t reg_flags;
+  uint32_t head = sock_info_non_rom->rx_ring_head;
+  uint32_t first;
+
+  if (length > sock_info_non_rom->rx_ring_count) {
+    length = sock_info_non_rom->rx_ring_count;
+  }
+  first = RSI_SOCKET_RX_RING_SIZE - head;
+  if (first >= (uint32_t)length) {
+    rsi_socket_recv_copy(sockID, (uint8_t *)buffer, 0, &ring[head], length);
   } else {
+    rsi_socket_recv_copy(sockID, (uint8_t *)buffer, 0, &ring[head], first);
+    rsi_socket_recv_copy(sockID, (uint8_t *)buffer, first, ring, length - first);
+  }
 
-    // Set socket family for IPv6
-    fromAddr6.sin6_family = AF_INET6;
-
-    // Set destination port
-    fromAddr6.sin6_port = rsi_socket_pool[sockID].destination_port;
+  if (!(flags & MSG_PEEK)) {
+    reg_flags                       = RSI_CRITICAL_SECTION_ENTRY();
+    sock_info_non_rom->rx_ring_head = (head + length) % RSI_SOCKET_RX_RING_SIZE;
+    sock_info_non_rom->rx_ring_count -= length;
+    RSI_CRITICAL_SECTION_EXIT(reg_flags);
+  }
+  return length;
+}
+#endif
 
-    // Set destination IPv6 address
-    memcpy(fromAddr6.sin6_addr._S6_un._S6_u8,
-           rsi_socket_pool[sockID].destination_ip_addr.ipv6,
-           RSI_IPV6_ADDRESS_LENGTH);
+/*==============================================*/
+/**
+ * @brief       Check whether data or termination of a socket is already known on host and not received yet.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @return      1              - Socket is ready to read \n
+ *              0              - Readiness is not known on host
+ */
+/// @private
+uint8_t rsi_socket_known_ready_to_read(int32_t sockID)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
 
-    status = rsi_sendto_async(sockID,
-                              (int8_t *)msg,
-                              msgLength,
-                              flags,
-                              (struct rsi_sockaddr *)&fromAddr6,
-                              sizeof(fromAddr6),
-                              data_transfer_complete_handler);
+  if (sock_info_non_rom->ready_to_read || sock_info_non_rom->socket_terminate_indication
+      || sock_info_non_rom->rx_ring_count
+#ifdef RSI_PROCESS_MAX_RX_DATA
+      || sock_info_non_rom->more_rx_data_pending
+#endif
+      || ((global_cb_p->rx_buffer_mem_copy == 1) && rsi_socket_pool[sockID].sock_recv_available_length)) {
+    return 1;
   }
-
-  // Return status
-  return status;
+  return 0;
 }
 
 /*==============================================*/
 /**
- * @brief       Send data to specific remote peer on a given socket
- * @param[in]   sockID                         - Socket descriptor ID
- * @param[in]   msg                            - Pointer to data that needs to be sent to remote peer
- * @param[in]   msgLength                      - Length of data to send
- * @param[in]   flags                          - Reserved
- * @param[in]   destAddr                       - Remote peer address to send data
- * @param[in]   destAddrLen                    - Remote peer address length
- * @param[in]   data_transfer_complete_handler - Pointer to callback function called after complete data transfer
- * @param[out]  sockID                         - Socket Descriptor ID
- * @param[out]  length                         - Number of bytes transfered
- * @return	Positive Value                 - Success, Returns the number of bytes sent successfully \n
- *              Negative Value                 - Failure \n
- *              zero                           - Socket close error
- *
- *  @note        Refer to Error Codes section for the description of the above error codes  \ref error-codes.
- *
+ * @brief       Find the sockets of the select sets whose readiness is already known on host, without querying module.
+ *              A socket is ready to read if module reported data or termination which is not received yet, or data is
+ *              left in host buffer. A socket is ready to write if it has TCP ACK indication buffers available or its last
+ *              data send completed. If any socket is ready, the sets are updated to hold only the ready sockets.
+ * @param[in]   nfds           - Highest-numbered socket descriptor in any of the sets, plus 1
+ * @param[in]   readfds        - Socket descriptors to check for data to receive, may be NULL
+ * @param[in]   writefds       - Socket descriptors to check for space to send data, may be NULL
+ * @return      Zero           - No socket known to be ready, sets are left unchanged \n
+ *              Positive Value - Total number of ready sockets across both sets
  */
 /// @private
-int32_t rsi_sendto_async_non_rom(int32_t sockID,
-                                 int8_t *msg,
-                                 int32_t msgLength,
-                                 int32_t flags,
-                                 struct rsi_sockaddr *destAddr,
-                                 int32_t destAddrLen,
-                                 void (*data_transfer_complete_handler)(int32_t sockID, uint16_t length))
+int32_t rsi_select_known_ready(int32_t nfds, rsi_fd_set *readfds, rsi_fd_set *writefds)
 {
-  UNUSED_PARAMETER(destAddrLen); //Added to resolve compilation warning, value is unchanged
-  int32_t status        = RSI_SUCCESS;
-  int32_t maximum_limit = 0;
-  uint8_t buffers_required;
-  UNUSED_PARAMETER(flags); // Added to resolve compilation warning, value is unchanged
-  rsi_driver_cb_t *rsi_driver_cb     = global_cb_p->rsi_driver_cb;
-  rsi_socket_info_t *sock_info       = &global_cb_p->rsi_socket_pool[sockID];
-  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+  rsi_socket_info_t *sock_info;
+  rsi_socket_info_non_rom_t *sock_info_non_rom;
+  rsi_fd_set read_ready_fds, write_ready_fds;
+  int32_t read_count = 0, write_count = 0;
+  int32_t index;
+
+  RSI_FD_ZERO(&read_ready_fds);
+  RSI_FD_ZERO(&write_ready_fds);
+
+  for (index = 0; index < nfds; index++) {
+    sock_info         = &rsi_socket_pool[index];
+    sock_info_non_rom = &rsi_socket_pool_non_rom[index];
+
+    if ((readfds != NULL) && RSI_FD_ISSET(index, readfds)) {
+      if (rsi_socket_known_ready_to_read(index)) {
+        RSI_FD_SET(index, &read_ready_fds);
+        read_count++;
+      }
+    }
+    if ((writefds != NULL) && RSI_FD_ISSET(index, writefds)) {
+      if ((sock_info->sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION) ? (sock_info->current_available_buffer_count != 0)
+                                                                         : sock_info_non_rom->ready_to_write) {
+        // Send completion is reported once, socket may be full by the time application sends again
+        sock_info_non_rom->ready_to_write = 0;
+        RSI_FD_SET(index, &write_ready_fds);
+        write_count++;
+      }
+    }
+  }
 
-#ifdef SOCKET_CLOSE_WAIT
-  if (rsi_socket_pool[sockID].sock_state > RSI_SOCKET_STATE_INIT && rsi_socket_pool_non_rom[sockID].close_pending) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_ECONNABORTED, sockID);
-#ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_ECONNABORTED);
-#endif
-    return RSI_SOCK_ERROR;
+  if ((read_count + write_count) == 0) {
+    return 0;
   }
-#endif
+  if (readfds != NULL) {
+    *readfds          = read_ready_fds;
+    readfds->fd_count = read_count;
+  }
+  if (writefds != NULL) {
+    *writefds          = write_ready_fds;
+    writefds->fd_count = write_count;
+  }
+  return read_count + write_count;
+}
 
-  if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
-#ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EBADF);
-#endif
-    return RSI_SOCK_ERROR;
+/*==============================================*/
+/**
+ * @brief       Queue events of a socket on an epoll instance. Events not registered on the socket are dropped,
+ *              except RSI_EPOLLERR and RSI_EPOLLHUP. Must be called within critical section.
+ * @param[in]   epoll          - Epoll instance
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   events         - Events to queue
+ * @return      1              - Waiting task is to be woken up by posting epoll_sem \n
+ *              0              - Otherwise
+ */
+/// @private
+static uint8_t rsi_epoll_queue_event(rsi_socket_epoll_info_t *epoll, int32_t sockID, uint32_t events)
+{
+  events &= epoll->interest[sockID];
+  if (events == 0) {
+    return 0;
   }
-  // If sockID is not in available range
-  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
-#ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EBADF);
-#endif
-    return RSI_SOCK_ERROR;
+  // Socket is queued once, later events are merged into the queued ones
+  if (epoll->ready[sockID] == 0) {
+    epoll->ready_ring[(epoll->ready_head + epoll->ready_count) % RSI_NUMBER_OF_SOCKETS] = (uint8_t)sockID;
+    epoll->ready_count++;
+  }
+  epoll->ready[sockID] |= events;
+  if (epoll->waiting) {
+    epoll->waiting = 0;
+    return 1;
   }
+  return 0;
+}
 
-  // If socket is in init state for UDP
-  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM)
-      && (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT)) {
+/*==============================================*/
+/**
+ * @brief       Report events of a socket to all epoll instances the socket is registered on.
+ *              Called by the driver on data receive, data send completion and socket termination.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   events         - RSI_EPOLLIN, RSI_EPOLLOUT, RSI_EPOLLERR and RSI_EPOLLHUP bits
+ * @return      Void
+ */
+/// @private
+void rsi_epoll_notify(int32_t sockID, uint32_t events)
+{
+  rsi_reg_flags_t flags;
+  int32_t i;
+
+  if ((sockID < 0) || (sockID >= RSI_NUMBER_OF_SOCKETS)) {
+    return;
+  }
+  for (i = 0; i < RSI_NUMBER_OF_EPOLLS; i++) {
+    // Posted under the lock in_use is checked with, as rsi_epoll_close() destroys the semaphore once it is cleared
+    flags = RSI_CRITICAL_SECTION_ENTRY();
+    if (rsi_socket_epoll_info[i].in_use && rsi_epoll_queue_event(&rsi_socket_epoll_info[i], sockID, events)) {
+      rsi_semaphore_post(&rsi_socket_epoll_info[i].epoll_sem);
+    }
+    RSI_CRITICAL_SECTION_EXIT(flags);
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Remove a socket from all epoll instances and drop its queued events.
+ * @param[in]   epoll          - Epoll instance
+ * @param[in]   sockID         - Socket descriptor ID
+ * @return      Void
+ */
+/// @private
+static void rsi_epoll_remove_socket(rsi_socket_epoll_info_t *epoll, int32_t sockID)
+{
+  uint8_t count = 0;
+  uint8_t index;
+  uint8_t i;
+
+  if (epoll->ready[sockID] != 0) {
+    // Compact ring keeping order of other sockets
+    for (i = 0; i < epoll->ready_count; i++) {
+      index = epoll->ready_ring[(epoll->ready_head + i) % RSI_NUMBER_OF_SOCKETS];
+      if (index != sockID) {
+        epoll->ready_ring[(epoll->ready_head + count) % RSI_NUMBER_OF_SOCKETS] = index;
+        count++;
+      }
+    }
+    epoll->ready_count = count;
+  }
+  epoll->interest[sockID] = 0;
+  epoll->ready[sockID]    = 0;
+}
+
+/*==============================================*/
+/**
+ * @brief       Remove a socket from all epoll instances. Called when the socket is closed or created.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @return      Void
+ */
+/// @private
+void rsi_epoll_forget_socket(int32_t sockID)
+{
+  rsi_reg_flags_t flags;
+  int32_t i;
+
+  if ((sockID < 0) || (sockID >= RSI_NUMBER_OF_SOCKETS)) {
+    return;
+  }
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  for (i = 0; i < RSI_NUMBER_OF_EPOLLS; i++) {
+    if (rsi_socket_epoll_info[i].in_use) {
+      rsi_epoll_remove_socket(&rsi_socket_epoll_info[i], sockID);
+    }
+  }
+  RSI_CRITICAL_SECTION_EXIT(flags);
+}
+
+/*==============================================*/
+/**
+ * @brief       Callback of the module select issued by rsi_epoll_wait(). Queues the reported events and wakes up
+ *              the task waiting on the epoll instance which issued the select.
+ * @param[in]   fd_read        - Sockets ready to read
+ * @param[in]   fd_write       - Sockets ready to write
+ * @param[in]   fd_except      - Not used
+ * @param[in]   status         - Select status
+ * @return      Void
+ */
+/// @private
+static void rsi_epoll_select_callback(rsi_fd_set *fd_read, rsi_fd_set *fd_write, rsi_fd_set *fd_except, int32_t status)
+{
+  rsi_socket_epoll_info_t *epoll = NULL;
+  rsi_reg_flags_t flags;
+  uint32_t events;
+  uint8_t wake = 0;
+  int32_t select_id;
+  int32_t i;
+  UNUSED_PARAMETER(fd_except);
+
+  // Select is identified by its fd sets, which are part of the select info
+  for (select_id = 0; select_id < RSI_NUMBER_OF_SELECTS; select_id++) {
+    if (fd_read == &rsi_socket_select_info[select_id].rsi_sel_read_fds_var) {
+      break;
+    }
+  }
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  for (i = 0; i < RSI_NUMBER_OF_EPOLLS; i++) {
+    epoll = &rsi_socket_epoll_info[i];
+    if (epoll->in_use && epoll->select_pending && (epoll->select_id == select_id)) {
+      break;
+    }
+  }
+  if (i < RSI_NUMBER_OF_EPOLLS) {
+    epoll->select_pending = 0;
+    if (status == RSI_SUCCESS) {
+      for (i = 0; i < RSI_NUMBER_OF_SOCKETS; i++) {
+        events = 0;
+        if (RSI_FD_ISSET(i, fd_read)) {
+          events |= RSI_EPOLLIN;
+        }
+        if (RSI_FD_ISSET(i, fd_write)) {
+          events |= RSI_EPOLLOUT;
+        }
+        if (rsi_socket_pool_non_rom[i].socket_terminate_indication) {
+          events |= RSI_EPOLLHUP;
+        }
+        if (events) {
+          wake |= rsi_epoll_queue_event(epoll, i, events);
+        }
+      }
+    }
+    // Waiting task issues next select if nothing is ready
+    if (epoll->waiting) {
+      epoll->waiting = 0;
+      wake           = 1;
+    }
+    // Posted under the lock, as rsi_epoll_close() destroys the semaphore once in_use is cleared
+    if (wake) {
+      rsi_semaphore_post(&epoll->epoll_sem);
+    }
+  }
+  RSI_CRITICAL_SECTION_EXIT(flags);
+}
+
+/*==============================================*/
+/**
+ * @brief       Issue an asynchronous module select for the registered sockets whose readiness module does not report
+ *              on its own: synchronous sockets waiting for data, listening sockets waiting for connections and
+ *              sockets without TCP ACK indication waiting for space to send. Answered in rsi_epoll_select_callback().
+ * @param[in]   epoll          - Epoll instance
+ * @param[in]   timeout_ms     - Select timeout in milliseconds
+ * @return      Positive Value - Select issued \n
+ *              Zero           - No socket to select on \n
+ *              Negative Value - Failure
+ */
+/// @private
+static int32_t rsi_epoll_select_request(rsi_socket_epoll_info_t *epoll, uint32_t timeout_ms)
+{
+  rsi_req_socket_select_t *select;
+  rsi_pkt_t *pkt                 = NULL;
+  rsi_driver_cb_t *rsi_driver_cb = global_cb_p->rsi_driver_cb;
+  uint32_t read_select_bitmap = 0, write_select_bitmap = 0;
+  rsi_reg_flags_t flags;
+  int32_t nfds = 0;
+  int32_t i;
+  int32_t index;
+
+  for (index = 0; index < RSI_NUMBER_OF_SOCKETS; index++) {
+    if (rsi_socket_pool[index].sock_state == RSI_SOCKET_STATE_LISTEN) {
+      // Listening socket is readable when a connection is pending to be accepted
+      if (epoll->interest[index] & RSI_EPOLLIN) {
+        read_select_bitmap |= BIT(rsi_socket_pool[index].sock_id);
+        nfds = index + 1;
+      }
+      continue;
+    }
+    if (rsi_socket_pool[index].sock_state != RSI_SOCKET_STATE_CONNECTED) {
+      continue;
+    }
+    if ((epoll->interest[index] & RSI_EPOLLIN) && (rsi_socket_pool[index].sock_bitmap & RSI_SOCKET_FEAT_SYNCHRONOUS)) {
+      read_select_bitmap |= BIT(rsi_socket_pool[index].sock_id);
+      nfds = index + 1;
+    }
+    if ((epoll->interest[index] & RSI_EPOLLOUT)
+        && !(rsi_socket_pool[index].sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION)) {
+      write_select_bitmap |= BIT(rsi_socket_pool[index].sock_id);
+      nfds = index + 1;
+    }
+  }
+  if (nfds == 0) {
+    return 0;
+  }
+
+  RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+  for (i = 0; i < RSI_NUMBER_OF_SELECTS; i++) {
+    if (rsi_socket_select_info[i].select_state == RSI_SOCKET_SELECT_STATE_INIT) {
+      break;
+    }
+  }
+  if (i >= RSI_NUMBER_OF_SELECTS) {
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBUSY);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  // Allocate packet
+  pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
+  if (pkt == NULL) {
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_ENOMEM);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  memset(&rsi_socket_select_info[i], 0, sizeof(rsi_socket_select_info_t));
+  rsi_socket_select_info[i].select_state         = RSI_SOCKET_SELECT_STATE_CREATE;
+  rsi_socket_select_info[i].sock_select_callback = rsi_epoll_select_callback;
+
+  // Fill the select req struct
+  select = (rsi_req_socket_select_t *)pkt->data;
+  memset(select, 0, sizeof(rsi_req_socket_select_t));
+  select->num_fd                          = nfds;
+  select->rsi_read_fds.fd_array[0]        = read_select_bitmap;
+  select->rsi_write_fds.fd_array[0]       = write_select_bitmap;
+  select->select_id                       = i;
+  select->rsi_select_timeval.tv_sec       = timeout_ms / 1000;
+  select->rsi_select_timeval.tv_usec      = (timeout_ms % 1000) * 1000;
+
+  flags                 = RSI_CRITICAL_SECTION_ENTRY();
+  epoll->select_id      = (uint8_t)i;
+  epoll->select_pending = 1;
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+  RSI_DRIVER_WLAN_SEND_CMD(RSI_WLAN_REQ_SELECT_REQUEST, pkt);
+  return 1;
+}
+/** @} */
+
+/** @addtogroup NETWORK5
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief       Create an epoll instance. Sockets are registered on it once using \ref rsi_epoll_ctl() and
+ *              their events are collected as they occur, so that a single task can wait on all of them using
+ *              \ref rsi_epoll_wait(). This is a non-blocking API.
+ * @param[in]   void
+ * @return      Zero and Positive Value - Epoll instance descriptor \n
+ *              Negative Value          - Failure
+ */
+int32_t rsi_epoll_create(void)
+{
+  rsi_socket_epoll_info_t *epoll;
+  rsi_reg_flags_t flags;
+  int32_t i;
+
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  for (i = 0; i < RSI_NUMBER_OF_EPOLLS; i++) {
+    if (!rsi_socket_epoll_info[i].in_use) {
+      memset(&rsi_socket_epoll_info[i], 0, sizeof(rsi_socket_epoll_info_t));
+      rsi_socket_epoll_info[i].in_use = 1;
+      break;
+    }
+  }
+  RSI_CRITICAL_SECTION_EXIT(flags);
+  if (i >= RSI_NUMBER_OF_EPOLLS) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EMFILE);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  epoll = &rsi_socket_epoll_info[i];
+  if (rsi_semaphore_create(&epoll->epoll_sem, 0) != RSI_ERROR_NONE) {
+    epoll->in_use = 0;
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_ENOMEM);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  return i;
+}
+/** @} */
+
+/** @addtogroup NETWORK5
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief       Register, modify or deregister the events of a socket on an epoll instance. This is a non-blocking API.
+ *              RSI_EPOLLERR and RSI_EPOLLHUP are always reported. A socket is deregistered automatically when it is
+ *              closed.
+ * @param[in]   epfd           - Epoll instance descriptor returned by \ref rsi_epoll_create()
+ * @param[in]   op             - RSI_EPOLL_CTL_ADD, RSI_EPOLL_CTL_MOD or RSI_EPOLL_CTL_DEL
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   event          - Events of interest and user data returned with them, not used with RSI_EPOLL_CTL_DEL
+ * @return      Zero           - Success \n
+ *              Negative Value - Failure
+ */
+int32_t rsi_epoll_ctl(int32_t epfd, int32_t op, int32_t sockID, struct rsi_epoll_event *event)
+{
+  rsi_socket_epoll_info_t *epoll;
+  rsi_reg_flags_t flags;
+  int32_t errno_val = 0;
+
+  if ((epfd < 0) || (epfd >= RSI_NUMBER_OF_EPOLLS) || !rsi_socket_epoll_info[epfd].in_use || (sockID < 0)
+      || (sockID >= RSI_NUMBER_OF_SOCKETS)) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBADF);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  if ((op != RSI_EPOLL_CTL_DEL) && (event == NULL)) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EINVAL);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  epoll = &rsi_socket_epoll_info[epfd];
+
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  switch (op) {
+    case RSI_EPOLL_CTL_ADD:
+      if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
+        errno_val = RSI_ERROR_EBADF;
+      } else if (epoll->interest[sockID] != 0) {
+        errno_val = RSI_ERROR_EEXIST;
+      } else {
+        epoll->interest[sockID] = event->events | RSI_EPOLLERR | RSI_EPOLLHUP;
+        epoll->data[sockID]     = event->data;
+      }
+      break;
+    case RSI_EPOLL_CTL_MOD:
+      if (epoll->interest[sockID] == 0) {
+        errno_val = RSI_ERROR_ENOENT;
+      } else {
+        epoll->interest[sockID] = event->events | RSI_EPOLLERR | RSI_EPOLLHUP;
+        epoll->data[sockID]     = event->data;
+        // Queued events no longer of interest are dropped when returned
+        epoll->ready[sockID] &= epoll->interest[sockID];
+      }
+      break;
+    case RSI_EPOLL_CTL_DEL:
+      if (epoll->interest[sockID] == 0) {
+        errno_val = RSI_ERROR_ENOENT;
+      } else {
+        rsi_epoll_remove_socket(epoll, sockID);
+      }
+      break;
+    default:
+      errno_val = RSI_ERROR_EINVAL;
+      break;
+  }
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  if (errno_val != 0) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(errno_val);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  return RSI_SUCCESS;
+}
+/** @} */
+
+/** @addtogroup NETWORK5
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief       Wait for events on the sockets registered on an epoll instance. Readiness already known on host is
+ *              returned at once, otherwise the call waits for data receive, data send completion or socket
+ *              termination reported by the driver. For synchronous sockets and sockets without TCP ACK indication
+ *              module is queried using an asynchronous select. This is a blocking API.
+ * @param[in]   epfd           - Epoll instance descriptor returned by \ref rsi_epoll_create()
+ * @param[out]  events         - Buffer to return the events, one entry per socket
+ * @param[in]   maxevents      - Number of entries in events
+ * @param[in]   timeout_ms     - Time to wait in milliseconds, 0 returns at once, -1 waits forever
+ * @return      Positive Value - Number of entries returned in events \n
+ *              Zero           - Time out \n
+ *              Negative Value - Failure
+ * @note        Only one task may wait on an epoll instance at a time.
+ */
+int32_t rsi_epoll_wait(int32_t epfd, struct rsi_epoll_event *events, int32_t maxevents, int32_t timeout_ms)
+{
+  rsi_socket_epoll_info_t *epoll;
+  rsi_reg_flags_t flags;
+  uint32_t start_time = 0, elapsed_time = 0, wait_time = 0;
+  uint32_t ready;
+  int32_t select_issued;
+  int32_t count = 0;
+  int32_t index;
+  uint8_t wait;
+
+  if ((epfd < 0) || (epfd >= RSI_NUMBER_OF_EPOLLS) || !rsi_socket_epoll_info[epfd].in_use) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBADF);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  if ((events == NULL) || (maxevents <= 0)) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EINVAL);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  epoll      = &rsi_socket_epoll_info[epfd];
+  start_time = rsi_hal_gettickcount();
+
+  while (1) {
+    flags = RSI_CRITICAL_SECTION_ENTRY();
+    // Readiness which lasts until the application acts on it is queued on every call
+    for (index = 0; index < RSI_NUMBER_OF_SOCKETS; index++) {
+      if (epoll->interest[index] == 0) {
+        continue;
+      }
+      if (rsi_socket_known_ready_to_read(index)) {
+        rsi_epoll_queue_event(epoll, index, RSI_EPOLLIN);
+      }
+      if (rsi_socket_pool[index].sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION) {
+        if (rsi_socket_pool[index].current_available_buffer_count != 0) {
+          rsi_epoll_queue_event(epoll, index, RSI_EPOLLOUT);
+        }
+      } else if (rsi_socket_pool_non_rom[index].ready_to_write) {
+        rsi_epoll_queue_event(epoll, index, RSI_EPOLLOUT);
+      }
+    }
+    while ((epoll->ready_count != 0) && (count < maxevents)) {
+      index = epoll->ready_ring[epoll->ready_head];
+      ready = epoll->ready[index];
+
+      epoll->ready_head = (epoll->ready_head + 1) % RSI_NUMBER_OF_SOCKETS;
+      epoll->ready_count--;
+      epoll->ready[index] = 0;
+      if (ready != 0) {
+        if (ready & RSI_EPOLLOUT) {
+          // Send completion is reported once, socket may be full by the time application sends again
+          rsi_socket_pool_non_rom[index].ready_to_write = 0;
+        }
+        events[count].events = ready;
+        events[count].data   = epoll->data[index];
+        count++;
+      }
+    }
+    RSI_CRITICAL_SECTION_EXIT(flags);
+    if (count != 0) {
+      return count;
+    }
+
+    if (timeout_ms >= 0) {
+      elapsed_time = rsi_hal_gettickcount() - start_time;
+      wait_time    = (elapsed_time < (uint32_t)timeout_ms) ? ((uint32_t)timeout_ms - elapsed_time) : 0;
+    }
+    if (epoll->select_pending) {
+      select_issued = 1;
+    } else {
+      select_issued = rsi_epoll_select_request(epoll, (timeout_ms >= 0) ? wait_time : RSI_EPOLL_SELECT_TIMEOUT_MS);
+      if (select_issued < 0) {
+        return RSI_SOCK_ERROR;
+      }
+    }
+    // Select answer of a zero timeout is returned by the next call
+    if ((timeout_ms >= 0) && (wait_time == 0)) {
+      return 0;
+    }
+
+    // Select may be answered already, then its events are collected or a new select is issued
+    flags = RSI_CRITICAL_SECTION_ENTRY();
+    wait  = ((epoll->ready_count == 0) && (epoll->select_pending || !select_issued));
+    if (wait) {
+      epoll->waiting = 1;
+    }
+    RSI_CRITICAL_SECTION_EXIT(flags);
+    if (wait) {
+      // Wait for an event or the select response, wait time 0 waits forever
+      rsi_semaphore_wait(&epoll->epoll_sem, wait_time);
+
+      flags          = RSI_CRITICAL_SECTION_ENTRY();
+      epoll->waiting = 0;
+      RSI_CRITICAL_SECTION_EXIT(flags);
+    }
+  }
+}
+/** @} */
+
+/** @addtogroup NETWORK5
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief       Close an epoll instance. Registered sockets are not affected. This is a non-blocking API.
+ * @param[in]   epfd           - Epoll instance descriptor returned by \ref rsi_epoll_create()
+ * @return      Zero           - Success \n
+ *              Negative Value - Failure
+ */
+int32_t rsi_epoll_close(int32_t epfd)
+{
+  rsi_socket_epoll_info_t *epoll;
+  rsi_reg_flags_t flags;
+
+  if ((epfd < 0) || (epfd >= RSI_NUMBER_OF_EPOLLS) || !rsi_socket_epoll_info[epfd].in_use) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBADF);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  epoll = &rsi_socket_epoll_info[epfd];
+
+  // A select still pending is answered to nobody. Semaphore is posted only under the lock with in_use set,
+  // so nothing posts it once in_use is cleared here.
+  flags                 = RSI_CRITICAL_SECTION_ENTRY();
+  epoll->in_use         = 0;
+  epoll->select_pending = 0;
+  epoll->waiting        = 0;
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  if (rsi_semaphore_destroy(&epoll->epoll_sem) != RSI_ERROR_NONE) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBUSY);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @brief       Get statistics of all sockets, indexed by socket descriptor. This is a non-blocking API.
+ * @param[out]  stats          - Array to hold statistics of sockets
+ * @param[in]   count          - Number of entries in stats
+ * @return      Positive Value - Number of entries filled \n
+ *              Negative Value - Failure
+ */
+int32_t rsi_socket_stats_get_all(struct rsi_socket_stats *stats, int32_t count)
+{
+  int32_t i;
+
+  if ((stats == NULL) || (count <= 0)) {
+    return RSI_SOCK_ERROR;
+  }
+  if (count > NUMBER_OF_SOCKETS) {
+    count = NUMBER_OF_SOCKETS;
+  }
+  for (i = 0; i < count; i++) {
+    memcpy(&stats[i], &rsi_socket_pool_non_rom[i].stats, sizeof(struct rsi_socket_stats));
+  }
+  return count;
+}
+/** @} */
+
+/** @addtogroup DRIVER10
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief      Account a latency in a socket statistics histogram
+ * @param[in]  hist       - Histogram of RSI_SOCKET_STATS_HIST_BUCKETS buckets
+ * @param[in]  latency_ms - Latency in ms
+ * @return     Void
+ *
+ */
+/// @private
+static void rsi_socket_stats_hist_add(uint32_t *hist, uint32_t latency_ms)
+{
+  uint8_t bucket = 0;
+
+  while ((bucket < (RSI_SOCKET_STATS_HIST_BUCKETS - 1)) && (latency_ms >= (1U << bucket))) {
+    bucket++;
+  }
+  hist[bucket]++;
+}
+
+/*==============================================*/
+/**
+ * @brief      Account a data packet queued to module, latency of the packet is sampled if none is
+ * @param[in]  sockID - Socket descriptor ID
+ * @param[in]  length - Data length of packet
+ * @return     Void
+ *
+ */
+/// @private
+void rsi_socket_stats_tx_queued(int32_t sockID, uint32_t length)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+
+  if (!sock_info_non_rom->tx_sample_pending) {
+    sock_info_non_rom->tx_sample_seq     = sock_info_non_rom->tx_queued_seq;
+    sock_info_non_rom->tx_sample_tick    = rsi_hal_gettickcount();
+    sock_info_non_rom->tx_sample_pending = 1;
+  }
+  sock_info_non_rom->tx_queued_seq++;
+  sock_info_non_rom->stats.tx_segments++;
+  sock_info_non_rom->stats.tx_bytes += length;
+}
+
+/*==============================================*/
+/**
+ * @brief      Account a data packet written to module or dropped, packets are done in the order queued
+ * @param[in]  sockID  - Socket descriptor ID
+ * @param[in]  written - 1 if written to module, 0 if dropped on module buffer full
+ * @return     Void
+ *
+ */
+/// @private
+void rsi_socket_stats_tx_done(int32_t sockID, uint8_t written)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+
+  if (written) {
+    sock_info_non_rom->stats.tx_completions++;
+  } else {
+    sock_info_non_rom->stats.tx_buffer_full++;
+  }
+  // Sampled packet is done, or was flushed without being reported
+  if (sock_info_non_rom->tx_sample_pending
+      && ((int32_t)(sock_info_non_rom->tx_done_seq - sock_info_non_rom->tx_sample_seq) >= 0)) {
+    if (written && (sock_info_non_rom->tx_done_seq == sock_info_non_rom->tx_sample_seq)) {
+      rsi_socket_stats_hist_add(sock_info_non_rom->stats.tx_latency_hist,
+                                rsi_hal_gettickcount() - sock_info_non_rom->tx_sample_tick);
+    }
+    sock_info_non_rom->tx_sample_pending = 0;
+  }
+  sock_info_non_rom->tx_done_seq++;
+}
+
+/*==============================================*/
+/**
+ * @brief      Account data received from module, its delay till application takes it is sampled if none is
+ * @param[in]  sockID - Socket descriptor ID
+ * @param[in]  length - Received data length
+ * @return     Void
+ *
+ */
+/// @private
+void rsi_socket_stats_rx_arrival(int32_t sockID, uint32_t length)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+
+  if (!sock_info_non_rom->rx_sample_pending) {
+    sock_info_non_rom->rx_sample_tick    = rsi_hal_gettickcount();
+    sock_info_non_rom->rx_sample_pending = 1;
+  }
+  sock_info_non_rom->stats.rx_segments++;
+  sock_info_non_rom->stats.rx_bytes += length;
+}
+
+/*==============================================*/
+/**
+ * @brief      Account received data handed to application
+ * @param[in]  sockID - Socket descriptor ID
+ * @return     Void
+ *
+ */
+/// @private
+void rsi_socket_stats_rx_delivered(int32_t sockID)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+
+  if (sock_info_non_rom->rx_sample_pending) {
+    rsi_socket_stats_hist_add(sock_info_non_rom->stats.rx_latency_hist,
+                              rsi_hal_gettickcount() - sock_info_non_rom->rx_sample_tick);
+    sock_info_non_rom->rx_sample_pending = 0;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Account time a call waited on a socket semaphore
+ * @param[in]  sockID     - Socket descriptor ID
+ * @param[in]  start_tick - Tick the wait started at
+ * @return     Void
+ *
+ */
+/// @private
+void rsi_socket_stats_wait_done(int32_t sockID, uint32_t start_tick)
+{
+  rsi_socket_pool_non_rom[sockID].stats.wait_time_ms += rsi_hal_gettickcount() - start_tick;
+}
+/** @} */
+
+/** @addtogroup NETWORK5
+* @{
+*/
+
+/*==============================================*/
+/**
+ * @brief      Get maximum data length that can be sent in one send call on a given socket
+ * @param[in]  sockID - Socket descriptor ID
+ * @return     Maximum data length
+ *
+ */
+/// @private
+static int32_t rsi_get_max_send_length(int32_t sockID)
+{
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM) {
+    // If it is a UDP socket
+    return 1472;
+  } else if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)
+             && ((rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_SSL)
+                 || (rsi_socket_pool_non_rom[sockID].ssl_bitmap))) {
+    // If it is a SSL socket/SSL websocket
+    return rsi_socket_pool_non_rom[sockID].mss - RSI_SSL_HEADER_SIZE;
+  } else if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)
+             && (rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_WEBS_SUPPORT)) {
+    // If it is a websocket
+    return 1450;
+  }
+  return rsi_socket_pool_non_rom[sockID].mss;
+}
+
+/*==============================================*/
+/**
+ * @brief       Check whether a call on a socket must return RSI_ERROR_EAGAIN instead of waiting
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   flags          - Flags of the call, MSG_DONTWAIT makes this call non-blocking
+ * @return      1              - Call must not wait \n
+ *              0              - Call may wait
+ */
+/// @private
+static uint8_t rsi_socket_dont_wait(int32_t sockID, int32_t flags)
+{
+  return ((flags & MSG_DONTWAIT) || rsi_socket_pool_non_rom[sockID].non_blocking) ? 1 : 0;
+}
+
+/*==============================================*/
+/**
+ * @brief       Callback of the select issued by rsi_socket_recv_probe(). Readiness is recorded by the select response
+ *              handler, so only the next probe is allowed here.
+ * @param[in]   fd_read        - Not used
+ * @param[in]   fd_write       - Not used
+ * @param[in]   fd_except      - Not used
+ * @param[in]   status         - Not used
+ * @return      Void
+ */
+/// @private
+static void rsi_socket_recv_probe_callback(rsi_fd_set *fd_read,
+                                           rsi_fd_set *fd_write,
+                                           rsi_fd_set *fd_except,
+                                           int32_t status)
+{
+  UNUSED_PARAMETER(fd_read);
+  UNUSED_PARAMETER(fd_write);
+  UNUSED_PARAMETER(fd_except);
+  UNUSED_PARAMETER(status);
+
+  rsi_wlan_cb_non_rom->recv_probe_pending = 0;
+}
+
+/*==============================================*/
+/**
+ * @brief       Ask module without waiting whether a socket has data to receive. Issued by a non-blocking receive
+ *              finding no data on host, which returns without waiting for the answer. Only one probe is pending
+ *              at a time, so that select slots are left to application.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @return      Void
+ */
+/// @private
+static void rsi_socket_recv_probe(int32_t sockID)
+{
+  rsi_fd_set read_fds;
+  struct rsi_timeval no_wait = { 0, 0 };
+  rsi_reg_flags_t flags;
+
+  flags = RSI_CRITICAL_SECTION_ENTRY();
+  if (rsi_wlan_cb_non_rom->recv_probe_pending) {
+    RSI_CRITICAL_SECTION_EXIT(flags);
+    return;
+  }
+  rsi_wlan_cb_non_rom->recv_probe_pending = 1;
+  RSI_CRITICAL_SECTION_EXIT(flags);
+
+  RSI_FD_ZERO(&read_fds);
+  RSI_FD_SET(sockID, &read_fds);
+  if (rsi_select(sockID + 1, &read_fds, NULL, NULL, &no_wait, rsi_socket_recv_probe_callback) < 0) {
+    rsi_wlan_cb_non_rom->recv_probe_pending = 0;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Send data on a given socket asynchronously
+ * @param[in]  sockID                         - Socket descriptor ID
+ * @param[in]  msg                            - Pointer to data that needs to be sent to remote peer
+ * @param[in]  msgLength                      - Length of data to send
+ * @param[in]  flags                          - Reserved
+ * @param[in]  data_transfer_complete_handler - Pointer to callback function called after complete data transfer
+ * @param[out] sockID                         - Socket Descriptor ID
+ * @param[out] length                         - Number of bytes transfered
+ * @return	Zero                           - Success \n
+ *             Negative Value                 - Failure
+ *
+ *  @note        Refer to Error Codes section for the description of the above error codes  \ref error-codes.
+ */
+/// @private
+int32_t rsi_send_async_non_rom(int32_t sockID,
+                               const int8_t *msg,
+                               int32_t msgLength,
+                               int32_t flags,
+                               void (*data_transfer_complete_handler)(int32_t sockID, uint16_t length))
+{
+  struct rsi_sockaddr_in fromAddr4;
+  struct rsi_sockaddr_in6 fromAddr6;
+  int32_t status                     = 0;
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBADF);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  if ((rsi_socket_pool[sockID].sock_type >> 4) == AF_INET) {
+
+    // Set socket family for IPv4
+    fromAddr4.sin_family = AF_INET;
+
+    // Set destination port
+    fromAddr4.sin_port = rsi_socket_pool[sockID].destination_port;
+
+    // Set destination IPv4 address
+    memcpy(&fromAddr4.sin_addr.s_addr, rsi_socket_pool[sockID].destination_ip_addr.ipv4, RSI_IPV4_ADDRESS_LENGTH);
+
+    status = rsi_sendto_async(sockID,
+                              (int8_t *)msg,
+                              msgLength,
+                              flags,
+                              (struct rsi_sockaddr *)&fromAddr4,
+                              sizeof(fromAddr4),
+                              data_transfer_complete_handler);
+  } else {
+
+    // Set socket family for IPv6
+    fromAddr6.sin6_family = AF_INET6;
+
+    // Set destination port
+    fromAddr6.sin6_port = rsi_socket_pool[sockID].destination_port;
+
+    // Set destination IPv6 address
+    memcpy(fromAddr6.sin6_addr._S6_un._S6_u8,
+           rsi_socket_pool[sockID].destination_ip_addr.ipv6,
+           RSI_IPV6_ADDRESS_LENGTH);
+
+    status = rsi_sendto_async(sockID,
+                              (int8_t *)msg,
+                              msgLength,
+                              flags,
+                              (struct rsi_sockaddr *)&fromAddr6,
+                              sizeof(fromAddr6),
+                              data_transfer_complete_handler);
+  }
+
+  // Return status
+  return status;
+}
+
+/*==============================================*/
+/**
+ * @brief       Create UDP socket in module on its first send, with the remote peer of that send.
+ *              Caller holds WLAN mutex.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   destAddr       - Remote peer address of first send
+ * @return      Zero           - Success \n
+ *              Negative Value - Failure
+ *
+ */
+/// @private
+static int32_t rsi_socket_create_udp_client(int32_t sockID, struct rsi_sockaddr *destAddr)
+{
+  int32_t status                     = RSI_SUCCESS;
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  if ((rsi_socket_pool[sockID].sock_type >> 4) == AF_INET) {
+    memcpy(rsi_socket_pool[sockID].destination_ip_addr.ipv4,
+           &(((struct rsi_sockaddr_in *)destAddr)->sin_addr.s_addr),
+           RSI_IPV4_ADDRESS_LENGTH);
+    rsi_socket_pool[sockID].destination_port = ntohs(((struct rsi_sockaddr_in *)destAddr)->sin_port);
+  } else {
+    memcpy(rsi_socket_pool[sockID].destination_ip_addr.ipv6,
+           ((struct rsi_sockaddr_in6 *)destAddr)->sin6_addr._S6_un._S6_u32,
+           RSI_IPV6_ADDRESS_LENGTH);
+    rsi_socket_pool[sockID].destination_port = ntohs(((struct rsi_sockaddr_in6 *)destAddr)->sin6_port);
+  }
+  // Create socket
+  status = rsi_socket_create_async(sockID, RSI_SOCKET_LUDP, 0);
+  if (status != RSI_SUCCESS) {
+    return status;
+  }
+
+  // Change state to connected
+  rsi_socket_pool[sockID].sock_state = RSI_SOCKET_STATE_CONNECTED;
+
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @brief       Send data to specific remote peer on a given socket
+ * @param[in]   sockID                         - Socket descriptor ID
+ * @param[in]   msg                            - Pointer to data that needs to be sent to remote peer
+ * @param[in]   msgLength                      - Length of data to send
+ * @param[in]   flags                          - Reserved
+ * @param[in]   destAddr                       - Remote peer address to send data
+ * @param[in]   destAddrLen                    - Remote peer address length
+ * @param[in]   data_transfer_complete_handler - Pointer to callback function called after complete data transfer
+ * @param[out]  sockID                         - Socket Descriptor ID
+ * @param[out]  length                         - Number of bytes transfered
+ * @return	Positive Value                 - Success, Returns the number of bytes sent successfully \n
+ *              Negative Value                 - Failure \n
+ *              zero                           - Socket close error
+ *
+ *  @note        Refer to Error Codes section for the description of the above error codes  \ref error-codes.
+ *
+ */
+/// @private
+int32_t rsi_sendto_async_non_rom(int32_t sockID,
+                                 int8_t *msg,
+                                 int32_t msgLength,
+                                 int32_t flags,
+                                 struct rsi_sockaddr *destAddr,
+                                 int32_t destAddrLen,
+                                 void (*data_transfer_complete_handler)(int32_t sockID, uint16_t length))
+{
+  UNUSED_PARAMETER(destAddrLen); //Added to resolve compilation warning, value is unchanged
+  int32_t status        = RSI_SUCCESS;
+  int32_t maximum_limit = 0;
+  uint8_t buffers_required;
+  uint32_t wait_start;
+  rsi_pkt_t *pkt;
+  rsi_driver_cb_t *rsi_driver_cb     = global_cb_p->rsi_driver_cb;
+  rsi_socket_info_t *sock_info       = &global_cb_p->rsi_socket_pool[sockID];
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+#ifdef SOCKET_CLOSE_WAIT
+  if (rsi_socket_pool[sockID].sock_state > RSI_SOCKET_STATE_INIT && rsi_socket_pool_non_rom[sockID].close_pending) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_ECONNABORTED, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_ECONNABORTED);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+#endif
+
+  if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBADF);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EBADF, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EBADF);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+
+#if (RSI_SOCKET_TX_PIPELINE_DEPTH || RSI_SOCKET_TX_BATCH)
+  // Data must not get in between data of large data send, nor of batch send not written yet
+  if ((rsi_socket_pool_non_rom[sockID].tx_pipe_count != 0)
+#if RSI_SOCKET_TX_PIPELINE_DEPTH
+      || (rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID))
+#endif
+  ) {
+    status = rsi_socket_dont_wait(sockID, flags) ? RSI_ERROR_EAGAIN : RSI_ERROR_EBUSY;
+    // Set error
+    rsi_wlan_socket_set_status(status, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(status);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+#endif
+
+  // If socket is in init state for UDP
+  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM)
+      && (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT)) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EPROTOTYPE, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EPROTOTYPE);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)
+      && (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED)) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EPROTOTYPE, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EPROTOTYPE);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+
+  // Check socket family
+  if (destAddr->sa_family != (rsi_socket_pool[sockID].sock_type >> 4)) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EFAULT, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EFAULT);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+
+  // Register the callback
+  rsi_wlan_cb_non_rom->nwk_callbacks.data_transfer_complete_handler = data_transfer_complete_handler;
+
+  // Acquire mutex lock
+  RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+
+  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM)
+      && (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED)) {
+    status = rsi_socket_create_udp_client(sockID, destAddr);
+    if (status != RSI_SUCCESS) {
+      // Release mutex lock
+      RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+#ifdef RSI_WITH_OS
+      status = rsi_get_error(sockID);
+      rsi_set_os_errno(status);
+#endif
+      return status;
+    }
+  }
+
+  // Find maximum limit based on the protocol
+  maximum_limit = rsi_get_max_send_length(sockID);
+
+  // Check maximum allowed length value
+  if (msgLength > maximum_limit) {
+    rsi_wlan_socket_set_status(RSI_ERROR_EMSGSIZE, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EMSGSIZE);
+#endif
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+    return RSI_SOCK_ERROR;
+  }
+  // Non-blocking send does not wait for module to take data while module buffers are full
+  if (rsi_socket_dont_wait(sockID, flags) && rsi_driver_cb_non_rom->tx_mask_event) {
+    rsi_socket_pool_non_rom[sockID].stats.tx_buffer_full++;
     // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_EPROTOTYPE, sockID);
+    rsi_wlan_socket_set_status(RSI_ERROR_EAGAIN, sockID);
+    // Release mutex lock
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
 #ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EPROTOTYPE);
+    rsi_set_os_errno(RSI_ERROR_EAGAIN);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  if (sock_info->sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION) {
+    // Wait for module to acknowledge sent data and free socket buffers. Asynchronous sends are not blocked, they
+    // may come from driver task context, where the acknowledgement could never be processed.
+    while ((sock_info->current_available_buffer_count == 0) && !rsi_socket_dont_wait(sockID, flags)
+           && (data_transfer_complete_handler == NULL)) {
+      RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+#ifndef RSI_SOCK_SEM_BITMAP
+      rsi_socket_pool_non_rom[sockID].socket_wait_bitmap |= BIT(2);
+#endif
+      wait_start = rsi_hal_gettickcount();
+      status = rsi_semaphore_wait(&rsi_socket_pool_non_rom[sockID].sock_send_sem, RSI_SEND_DATA_RESPONSE_WAIT_TIME);
+      rsi_socket_stats_wait_done(sockID, wait_start);
+      RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+      if ((status != RSI_ERROR_NONE) || (sock_info->sock_state != RSI_SOCKET_STATE_CONNECTED)) {
+        break;
+      }
+    }
+    // Return if buffers are not available
+    if (sock_info->current_available_buffer_count == 0) {
+      rsi_socket_pool_non_rom[sockID].stats.tx_buffer_full++;
+      // Set no buffers status and return, non-blocking socket is to try again once buffers are acknowledged
+      status = rsi_socket_dont_wait(sockID, flags) ? RSI_ERROR_EAGAIN : RSI_ERROR_ENOBUFS;
+      rsi_wlan_socket_set_status(status, sockID);
+      // Release mutex lock
+      RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+#ifdef RSI_WITH_OS
+      rsi_set_os_errno(status);
+#endif
+      return RSI_SOCK_ERROR;
+    }
+
+    // Calculate buffers required for sending this length
+    buffers_required = calculate_buffers_required(sock_info->sock_type, msgLength);
+
+    if (buffers_required > sock_info->current_available_buffer_count) {
+      // Calculate length can be sent with available buffers
+      msgLength                                 = global_cb_p->rom_apis_p->ROM_WL_calculate_length_to_send(global_cb_p,
+                                                                           sock_info->sock_type,
+                                                                           sock_info->current_available_buffer_count);
+      sock_info->current_available_buffer_count = 0;
+    } else {
+      // Subtract buffers required to send this packet
+      if (sock_info->current_available_buffer_count > buffers_required) {
+        sock_info->current_available_buffer_count -= buffers_required;
+      } else {
+        sock_info->current_available_buffer_count = 0;
+      }
+    }
+
+    // Set expected response based on the callback
+    if (data_transfer_complete_handler != NULL) {
+#ifdef RSI_UART_INTERFACE
+      rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_UART_DATA_ACK;
+#else
+      rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_ASYNCHRONOUS;
+#endif
+    } else {
+      rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_TCP_ACK_INDICATION;
+    }
+  } else {
+#ifdef RSI_UART_INTERFACE
+    rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_UART_DATA_ACK;
+#else
+    rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_ASYNCHRONOUS;
+#endif
+  }
+
+  if ((msg == NULL) && (rsi_socket_pool_non_rom[sockID].reserved_pkt != NULL)) {
+    // Send packet already filled by application, packet is freed by the driver
+    pkt                                          = rsi_socket_pool_non_rom[sockID].reserved_pkt;
+    rsi_socket_pool_non_rom[sockID].reserved_pkt = NULL;
+    status                                       = rsi_driver_send_pkt(sockID, pkt, msgLength, destAddr);
+  } else {
+    // Send data send command
+    status = rsi_driver_send_data(sockID, (uint8_t *)msg, msgLength, destAddr);
+  }
+
+  // Release mutex lock
+  RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+
+  if (status == RSI_SUCCESS) {
+    return msgLength;
+  } else if (rsi_socket_dont_wait(sockID, flags)
+             && (rsi_wlan_socket_get_status(sockID) == RSI_ERROR_PKT_ALLOCATION_FAILURE)) {
+    // No data packet free, non-blocking socket is to try again once one is written to module
+    rsi_wlan_socket_set_status(RSI_ERROR_EAGAIN, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EAGAIN);
+#endif
+    return RSI_SOCK_ERROR;
+  } else {
+#ifdef RSI_WITH_OS
+    status = rsi_get_error(sockID);
+    rsi_set_os_errno(status);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Reserve a data packet on a given socket. Packet may come from the command pool, so the caller
+ *              must commit or release it before returning.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msgLength      - Maximum length of data to be written into the packet
+ * @return      Non-NULL       - Pointer to write data to \n
+ *              NULL           - Failure, error is set as socket status
+ *
+ */
+/// @private
+static int8_t *rsi_send_reserve_pkt(int32_t sockID, int32_t msgLength)
+{
+  int32_t status                     = RSI_SUCCESS;
+  uint8_t *payload                   = NULL;
+  rsi_pkt_t *pkt                     = NULL;
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  if (rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT) {
+    status = RSI_ERROR_EBADF;
+  } else if (rsi_socket_pool_non_rom[sockID].reserved_pkt != NULL) {
+    // Packet is already reserved on this socket
+    status = RSI_ERROR_EBUSY;
+  } else if ((msgLength <= 0) || (msgLength > rsi_get_max_send_length(sockID))) {
+    status = RSI_ERROR_EMSGSIZE;
+  }
+  if (status != RSI_SUCCESS) {
+    // Set error
+    rsi_wlan_socket_set_status(status, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(status);
+#endif
+    return NULL;
+  }
+
+  pkt = rsi_driver_send_data_alloc(sockID, msgLength, &payload);
+  if (pkt == NULL) {
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(rsi_get_error(sockID));
+#endif
+    return NULL;
+  }
+
+  rsi_socket_pool_non_rom[sockID].reserved_pkt    = pkt;
+  rsi_socket_pool_non_rom[sockID].reserved_length = msgLength;
+
+  return (int8_t *)payload;
+}
+
+/*==============================================*/
+/**
+ * @brief       Reserve a data packet on a given socket, so that application can write data directly into it
+ *              and send it using \ref rsi_send_commit() or \ref rsi_sendto_commit() without a copy.
+ *              Only one packet can be reserved per socket. This API blocks if no data packet is free.
+ * @pre         \ref rsi_socket() API needs to be called before this API. A WLAN data tx pool must be configured
+ *              using RSI_WLAN_DATA_TX_POOL_PKT_COUNT, otherwise the reserved packet would be taken from the
+ *              pool commands are sent from, and the API fails with RSI_ERROR_EOPNOTSUPP.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msgLength      - Maximum length of data to be written into the packet
+ * @return      Non-NULL       - Pointer to write data to \n
+ *              NULL           - Failure, error is set as socket status
+ *
+ */
+int8_t *rsi_send_reserve(int32_t sockID, int32_t msgLength)
+{
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return NULL;
+  }
+
+  // Holding a packet of the command pool would block every command till it is committed
+  if (rsi_wlan_get_data_tx_pool() == &rsi_driver_cb->wlan_cb->wlan_tx_pool) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EOPNOTSUPP, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EOPNOTSUPP);
+#endif
+    return NULL;
+  }
+
+  return rsi_send_reserve_pkt(sockID, msgLength);
+}
+
+/*==============================================*/
+/**
+ * @brief       Check reserved packet of a socket before sending it
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msgLength      - Length of data written into reserved packet
+ * @return      Zero           - Success \n
+ *              Negative Value - Failure
+ *
+ */
+/// @private
+static int32_t rsi_check_reserved_pkt(int32_t sockID, int32_t msgLength)
+{
+  int32_t status = RSI_SUCCESS;
+
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return RSI_SOCK_ERROR;
+  }
+
+  if (rsi_socket_pool_non_rom[sockID].reserved_pkt == NULL) {
+    status = RSI_ERROR_EINVAL;
+  } else if ((msgLength <= 0) || (msgLength > rsi_socket_pool_non_rom[sockID].reserved_length)) {
+    status = RSI_ERROR_EMSGSIZE;
+  }
+  if (status != RSI_SUCCESS) {
+    // Set error
+    rsi_wlan_socket_set_status(status, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(status);
 #endif
     return RSI_SOCK_ERROR;
   }
-  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)
-      && (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED)) {
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @brief       Send data written into the packet reserved by \ref rsi_send_reserve() to the connected remote peer.
+ *              This is a blocking API. Reserved packet is released once the send is attempted; if the API fails
+ *              before that, packet stays reserved and can be committed again or released using \ref rsi_send_release().
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msgLength      - Length of data written, not more than the reserved length
+ * @param[in]   flags          - Reserved
+ * @return      Positive Value - Success, returns the number of bytes sent successfully \n
+ *              Negative Value - Failure
+ *
+ */
+int32_t rsi_send_commit(int32_t sockID, int32_t msgLength, int32_t flags)
+{
+  if (rsi_check_reserved_pkt(sockID, msgLength) != RSI_SUCCESS) {
+    return RSI_SOCK_ERROR;
+  }
+  return rsi_send_async_non_rom(sockID, NULL, msgLength, flags, NULL);
+}
+
+/*==============================================*/
+/**
+ * @brief       Send data written into the packet reserved by \ref rsi_send_reserve() to a specific remote peer.
+ *              This is a blocking API. Reserved packet is handled as in \ref rsi_send_commit().
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msgLength      - Length of data written, not more than the reserved length
+ * @param[in]   flags          - Reserved
+ * @param[in]   destAddr       - Address of the remote peer to send data
+ * @param[in]   destAddrLen    - Length of the address in bytes
+ * @return      Positive Value - Success, returns the number of bytes sent successfully \n
+ *              Negative Value - Failure
+ *
+ */
+int32_t rsi_sendto_commit(int32_t sockID,
+                          int32_t msgLength,
+                          int32_t flags,
+                          struct rsi_sockaddr *destAddr,
+                          int32_t destAddrLen)
+{
+  if (rsi_check_reserved_pkt(sockID, msgLength) != RSI_SUCCESS) {
+    return RSI_SOCK_ERROR;
+  }
+  return rsi_sendto_async_non_rom(sockID, NULL, msgLength, flags, destAddr, destAddrLen, NULL);
+}
+
+/*==============================================*/
+/**
+ * @brief       Release the packet reserved by \ref rsi_send_reserve() without sending it
+ * @param[in]   sockID - Socket descriptor ID
+ * @return      Void
+ *
+ */
+void rsi_send_release(int32_t sockID)
+{
+  rsi_pkt_t *pkt;
+
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return;
+  }
+
+  pkt                                          = rsi_socket_pool_non_rom[sockID].reserved_pkt;
+  rsi_socket_pool_non_rom[sockID].reserved_pkt = NULL;
+  if (pkt != NULL) {
+    rsi_pkt_free(rsi_wlan_get_data_tx_pool(), pkt);
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Copy data between a scatter/gather list and a contiguous buffer
+ * @param[in]   iov            - Scatter/gather list
+ * @param[in]   iovlen         - Number of entries in scatter/gather list
+ * @param[in]   offset         - Position in scatter/gather list to start copy at
+ * @param[in]   buffer         - Contiguous buffer
+ * @param[in]   length         - Number of bytes to copy
+ * @param[in]   to_iov         - 1 to copy buffer into list, 0 to copy list into buffer
+ * @return      Void
+ *
+ */
+/// @private
+static void rsi_iovec_copy(const struct rsi_iovec *iov,
+                           uint32_t iovlen,
+                           uint32_t offset,
+                           uint8_t *buffer,
+                           uint32_t length,
+                           uint8_t to_iov)
+{
+  uint32_t i;
+  uint32_t chunk_size;
+
+  for (i = 0; (i < iovlen) && length; i++) {
+    if (offset >= iov[i].iov_len) {
+      offset -= iov[i].iov_len;
+      continue;
+    }
+    chunk_size = MIN(iov[i].iov_len - offset, length);
+    if (to_iov) {
+      memcpy((uint8_t *)iov[i].iov_base + offset, buffer, chunk_size);
+    } else {
+      memcpy(buffer, (uint8_t *)iov[i].iov_base + offset, chunk_size);
+    }
+    buffer += chunk_size;
+    length -= chunk_size;
+    offset = 0;
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief       Copy received data to the receive buffer of a socket, or to the scatter list given
+ *              by \ref rsi_recvmsg() while it is waiting.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   buffer         - Receive buffer
+ * @param[in]   offset         - Position in receive buffer to copy data to
+ * @param[in]   data           - Received data
+ * @param[in]   length         - Length of received data
+ * @return      Void
+ *
+ */
+/// @private
+void rsi_socket_recv_copy(int32_t sockID, uint8_t *buffer, uint32_t offset, const uint8_t *data, uint32_t length)
+{
+  rsi_socket_info_non_rom_t *sock_info_non_rom = &rsi_socket_pool_non_rom[sockID];
+
+  if (sock_info_non_rom->recv_iov == NULL) {
+    memcpy(buffer + offset, data, length);
+  } else {
+    rsi_iovec_copy(sock_info_non_rom->recv_iov,
+                   sock_info_non_rom->recv_iovlen,
+                   sock_info_non_rom->recv_iov_offset + offset,
+                   (uint8_t *)data,
+                   length,
+                   1);
+  }
+}
+
+/** @addtogroup NETWORK5
+* @{
+*/
+/*==============================================*/
+/**
+ * @brief       Send data gathered from a list of buffers. Data is copied from the buffers straight into the data
+ *              packet, so a header and a payload kept apart by the application go out in one packet.
+ *              This is a blocking API.
+ * @pre         \ref rsi_socket() API needs to be called before this API. No packet must be reserved
+ *              using \ref rsi_send_reserve() on the socket.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msg            - Message, msg_iov and msg_iovlen give the data; msg_name and msg_namelen give the
+ *                               remote peer, or NULL to send to the connected remote peer. msg_control is not supported.
+ * @param[in]   flags          - Reserved
+ * @return      Positive Value - Success, returns the number of bytes sent successfully \n
+ *              Negative Value - Failure
+ * @note        A datagram must fit in one packet. Stream data larger than one packet is sent in several packets;
+ *              if one of them fails, the number of bytes sent before is returned.
+ *
+ */
+int32_t rsi_sendmsg(int32_t sockID, const struct rsi_msghdr *msg, int32_t flags)
+{
+  int32_t status    = RSI_SUCCESS;
+  int32_t sent      = 0;
+  int32_t msgLength = 0;
+  int32_t chunk_size;
+  int8_t *payload;
+  uint32_t i;
+  rsi_driver_cb_t *rsi_driver_cb     = global_cb_p->rsi_driver_cb;
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return RSI_SOCK_ERROR;
+  }
+
+  if ((msg == NULL) || ((msg->msg_iov == NULL) && (msg->msg_iovlen != 0))) {
     // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_EPROTOTYPE, sockID);
+    rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
 #ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EPROTOTYPE);
+    rsi_set_os_errno(RSI_ERROR_EINVAL);
 #endif
     return RSI_SOCK_ERROR;
   }
 
-  // Check socket family
-  if (destAddr->sa_family != (rsi_socket_pool[sockID].sock_type >> 4)) {
-    // Set error
-    rsi_wlan_socket_set_status(RSI_ERROR_EFAULT, sockID);
+  for (i = 0; i < msg->msg_iovlen; i++) {
+    msgLength += (int32_t)msg->msg_iov[i].iov_len;
+  }
+
+  // UDP socket is created in module before a packet is reserved, as creating it takes a packet too
+  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM) && (msg->msg_name != NULL)
+      && (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_INIT)
+      && (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED)) {
+    if (((struct rsi_sockaddr *)msg->msg_name)->sa_family != (rsi_socket_pool[sockID].sock_type >> 4)) {
+      status = RSI_ERROR_EFAULT;
+    } else {
+      // Acquire mutex lock
+      RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+      status = rsi_socket_create_udp_client(sockID, (struct rsi_sockaddr *)msg->msg_name);
+      // Release mutex lock
+      RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+      if (status != RSI_SUCCESS) {
+        status = rsi_wlan_socket_get_status(sockID);
+      }
+    }
+    if (status != RSI_SUCCESS) {
+      // Set error
+      rsi_wlan_socket_set_status(status, sockID);
 #ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EFAULT);
+      rsi_set_os_errno(status);
 #endif
-    return RSI_SOCK_ERROR;
+      return RSI_SOCK_ERROR;
+    }
   }
 
-  // Register the callback
-  rsi_wlan_cb_non_rom->nwk_callbacks.data_transfer_complete_handler = data_transfer_complete_handler;
+  do {
+    chunk_size = msgLength - sent;
+    // Datagram larger than one packet is refused by rsi_send_reserve_pkt()
+    if ((rsi_socket_pool[sockID].sock_type & SOCK_STREAM) && (chunk_size > rsi_get_max_send_length(sockID))) {
+      chunk_size = rsi_get_max_send_length(sockID);
+    }
+
+    payload = rsi_send_reserve_pkt(sockID, chunk_size);
+    if (payload == NULL) {
+      status = RSI_SOCK_ERROR;
+      break;
+    }
+    rsi_iovec_copy(msg->msg_iov, msg->msg_iovlen, sent, (uint8_t *)payload, chunk_size, 0);
+
+    if (msg->msg_name != NULL) {
+      status = rsi_sendto_commit(sockID,
+                                 chunk_size,
+                                 flags,
+                                 (struct rsi_sockaddr *)msg->msg_name,
+                                 (int32_t)msg->msg_namelen);
+    } else {
+      status = rsi_send_commit(sockID, chunk_size, flags);
+    }
+    // Packet stays reserved if send was not attempted
+    rsi_send_release(sockID);
+    if (status < 0) {
+      break;
+    }
+    sent += status;
+  } while (sent < msgLength);
+
+  return sent ? sent : status;
+}
+
+#if RSI_SOCKET_TX_BATCH
+/*==============================================*/
+/**
+ * @brief       Queue datagrams of several messages to module without waiting for each of them, then wait once
+ *              till all of them are written. If the call must not wait, datagrams are only queued, as long as
+ *              packets are free.
+ * @param[in]   sockID         - Socket descriptor ID, UDP socket already created in module
+ * @param[in]   msgvec         - Messages to send, msg_len of each message queued is set to its length
+ * @param[in]   vlen           - Number of messages
+ * @param[in]   flags          - MSG_DONTWAIT to return without waiting
+ * @return      Positive Value - Number of messages written to module before the first failure, or queued
+ *                               if the call must not wait \n
+ *              Negative Value - Failure, no message was written or queued
+ *
+ */
+/// @private
+static int32_t rsi_sendmmsg_batch(int32_t sockID, struct rsi_mmsghdr *msgvec, uint32_t vlen, int32_t flags)
+{
+  struct rsi_sockaddr_in fromAddr4;
+  struct rsi_sockaddr_in6 fromAddr6;
+  struct rsi_sockaddr *peerAddr;
+  struct rsi_sockaddr *destAddr;
+  struct rsi_msghdr *msg;
+  rsi_reg_flags_t cs_flags;
+  rsi_pkt_t *pkt;
+  uint8_t *payload;
+  uint8_t pending;
+  int32_t status = RSI_SUCCESS;
+  int32_t msgLength;
+  int32_t done;
+  uint32_t queued;
+  uint32_t i;
+  uint32_t j;
+  rsi_driver_cb_t *rsi_driver_cb                     = global_cb_p->rsi_driver_cb;
+  rsi_socket_info_t *sock_info                       = &global_cb_p->rsi_socket_pool[sockID];
+  rsi_socket_info_non_rom_t *rsi_sock_info_non_rom_p = &rsi_socket_pool_non_rom[sockID];
+  int32_t maximum_length                             = rsi_get_max_send_length(sockID);
+  uint8_t dont_wait                                  = rsi_socket_dont_wait(sockID, flags);
+
+  // Messages without address go to the remote peer of the socket
+  if ((sock_info->sock_type >> 4) == AF_INET) {
+    fromAddr4.sin_family = AF_INET;
+    fromAddr4.sin_port   = sock_info->destination_port;
+    memcpy(&fromAddr4.sin_addr.s_addr, sock_info->destination_ip_addr.ipv4, RSI_IPV4_ADDRESS_LENGTH);
+    peerAddr = (struct rsi_sockaddr *)&fromAddr4;
+  } else {
+    fromAddr6.sin6_family = AF_INET6;
+    fromAddr6.sin6_port   = sock_info->destination_port;
+    memcpy(fromAddr6.sin6_addr._S6_un._S6_u8, sock_info->destination_ip_addr.ipv6, RSI_IPV6_ADDRESS_LENGTH);
+    peerAddr = (struct rsi_sockaddr *)&fromAddr6;
+  }
 
   // Acquire mutex lock
   RSI_MUTEX_LOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
 
-  if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM)
-      && (rsi_socket_pool[sockID].sock_state != RSI_SOCKET_STATE_CONNECTED)) {
-    if ((rsi_socket_pool[sockID].sock_type >> 4) == AF_INET) {
-      memcpy(rsi_socket_pool[sockID].destination_ip_addr.ipv4,
-             &(((struct rsi_sockaddr_in *)destAddr)->sin_addr.s_addr),
-             RSI_IPV4_ADDRESS_LENGTH);
-      rsi_socket_pool[sockID].destination_port = ntohs(((struct rsi_sockaddr_in *)destAddr)->sin_port);
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+  // Data must not get in between data of large data send
+  if ((rsi_sock_info_non_rom_p->tx_pipe_count != 0) || (rsi_wlan_cb_non_rom->socket_bitmap & BIT(sockID))) {
+    RSI_CRITICAL_SECTION_EXIT(cs_flags);
+    // Release mutex lock
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+    status = dont_wait ? RSI_ERROR_EAGAIN : RSI_ERROR_EBUSY;
+    // Set error
+    rsi_wlan_socket_set_status(status, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(status);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  // Batch holds one count itself, so it is not reported done before all its packets are queued
+  rsi_sock_info_non_rom_p->tx_pipe_count  = 1;
+  rsi_sock_info_non_rom_p->tx_pipe_done   = 0;
+  rsi_sock_info_non_rom_p->tx_pipe_status = RSI_SUCCESS;
+  rsi_sock_info_non_rom_p->tx_pipe_sync   = 1;
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
+
+  for (i = 0; i < vlen; i++) {
+    msg       = &msgvec[i].msg_hdr;
+    msgLength = 0;
+    if ((msg->msg_iov == NULL) && (msg->msg_iovlen != 0)) {
+      status = RSI_ERROR_EINVAL;
+      break;
+    }
+    for (j = 0; j < msg->msg_iovlen; j++) {
+      msgLength += (int32_t)msg->msg_iov[j].iov_len;
+    }
+    if ((msgLength <= 0) || (msgLength > maximum_length)) {
+      status = RSI_ERROR_EMSGSIZE;
+      break;
+    }
+    destAddr = (msg->msg_name != NULL) ? (struct rsi_sockaddr *)msg->msg_name : peerAddr;
+    if (destAddr->sa_family != (sock_info->sock_type >> 4)) {
+      status = RSI_ERROR_EFAULT;
+      break;
+    }
+
+    if (dont_wait) {
+      pkt    = rsi_driver_send_data_alloc_non_blocking(sockID, msgLength, &payload);
+      status = RSI_ERROR_EAGAIN;
     } else {
-      memcpy(rsi_socket_pool[sockID].destination_ip_addr.ipv6,
-             ((struct rsi_sockaddr_in6 *)destAddr)->sin6_addr._S6_un._S6_u32,
-             RSI_IPV6_ADDRESS_LENGTH);
-      rsi_socket_pool[sockID].destination_port = ntohs(((struct rsi_sockaddr_in6 *)destAddr)->sin6_port);
+      pkt    = rsi_driver_send_data_alloc(sockID, msgLength, &payload);
+      status = RSI_ERROR_PKT_ALLOCATION_FAILURE;
     }
-    // Create socket
-    status = rsi_socket_create_async(sockID, RSI_SOCKET_LUDP, 0);
-    if (status != RSI_SUCCESS) {
-      // Release mutex lock
-      RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+    if (pkt == NULL) {
+      break;
+    }
+    status = RSI_SUCCESS;
+    rsi_iovec_copy(msg->msg_iov, msg->msg_iovlen, 0, payload, msgLength, 0);
+
+    cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+    rsi_sock_info_non_rom_p->tx_pipe_count++;
+    RSI_CRITICAL_SECTION_EXIT(cs_flags);
+    if (rsi_driver_queue_pkt(sockID, pkt, msgLength, destAddr) != RSI_SUCCESS) {
+      cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+      rsi_sock_info_non_rom_p->tx_pipe_count--;
+      RSI_CRITICAL_SECTION_EXIT(cs_flags);
+      status = rsi_wlan_socket_get_status(sockID);
+      break;
+    }
+    msgvec[i].msg_len = (uint32_t)msgLength;
+  }
+  queued = i;
+
+  // Drop own count and wait for packets still queued
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+  rsi_sock_info_non_rom_p->tx_pipe_count--;
+  pending = (rsi_sock_info_non_rom_p->tx_pipe_count != 0);
+  if (dont_wait) {
+    // Packets are written later, other sends are refused till then
+    rsi_sock_info_non_rom_p->tx_pipe_sync = 0;
+    RSI_CRITICAL_SECTION_EXIT(cs_flags);
+    // Release mutex lock
+    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+    if (queued == 0) {
+      // Set error
+      rsi_wlan_socket_set_status(status, sockID);
 #ifdef RSI_WITH_OS
-      status = rsi_get_error(sockID);
       rsi_set_os_errno(status);
 #endif
-      return status;
+      return RSI_SOCK_ERROR;
     }
+    return (int32_t)queued;
+  }
+  if (pending) {
+#ifndef RSI_SOCK_SEM_BITMAP
+    rsi_sock_info_non_rom_p->socket_wait_bitmap |= BIT(2);
+#endif
+  } else {
+    rsi_sock_info_non_rom_p->tx_pipe_sync = 0;
+  }
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
+
+  if (pending
+      && (rsi_wait_on_socket_semaphore(&rsi_sock_info_non_rom_p->sock_send_sem, RSI_SEND_DATA_RESPONSE_WAIT_TIME)
+          != RSI_ERROR_NONE)) {
+    // Packets written later are not reported
+    cs_flags                              = RSI_CRITICAL_SECTION_ENTRY();
+    rsi_sock_info_non_rom_p->tx_pipe_sync = 0;
+    RSI_CRITICAL_SECTION_EXIT(cs_flags);
+    if (status == RSI_SUCCESS) {
+      status = RSI_ERROR_RESPONSE_TIMEOUT;
+    }
+  }
 
-    // Change state to connected
-    rsi_socket_pool[sockID].sock_state = RSI_SOCKET_STATE_CONNECTED;
+  cs_flags = RSI_CRITICAL_SECTION_ENTRY();
+  done     = rsi_sock_info_non_rom_p->tx_pipe_done;
+  if ((status == RSI_SUCCESS) && (rsi_sock_info_non_rom_p->tx_pipe_status != RSI_SUCCESS)) {
+    status = rsi_sock_info_non_rom_p->tx_pipe_status;
   }
+  RSI_CRITICAL_SECTION_EXIT(cs_flags);
 
-  // Find maximum limit based on the protocol
-  if ((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM) {
-    // If it is a UDP socket
-    maximum_limit = 1472;
-  } else if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)
-             && ((rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_SSL)
-                 || (rsi_socket_pool_non_rom[sockID].ssl_bitmap))) {
-    // If it is a SSL socket/SSL websocket
-    maximum_limit = rsi_socket_pool_non_rom[sockID].mss - RSI_SSL_HEADER_SIZE;
-  } else if (((rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_STREAM)
-             && (rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_WEBS_SUPPORT)) {
-    // If it is a websocket
-    maximum_limit = 1450;
-  } else {
-    maximum_limit = rsi_socket_pool_non_rom[sockID].mss;
+  // Release mutex lock
+  RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+
+  // Messages are written in order, count the ones fully written before the first failure
+  for (i = 0; (i < queued) && (done >= (int32_t)msgvec[i].msg_len); i++) {
+    done -= (int32_t)msgvec[i].msg_len;
   }
 
-  // Check maximum allowed length value
-  if (msgLength > maximum_limit) {
-    rsi_wlan_socket_set_status(RSI_ERROR_EMSGSIZE, sockID);
+  if ((i == 0) && (status != RSI_SUCCESS)) {
+    // Set error
+    rsi_wlan_socket_set_status(status, sockID);
 #ifdef RSI_WITH_OS
-    rsi_set_os_errno(RSI_ERROR_EMSGSIZE);
+    rsi_set_os_errno(status);
 #endif
-    RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
     return RSI_SOCK_ERROR;
   }
-  if (sock_info->sock_bitmap & RSI_SOCKET_FEAT_TCP_ACK_INDICATION) {
-    // Return if buffers are not available
-    if (sock_info->current_available_buffer_count == 0) {
-      // Set no buffers status and return
-      rsi_wlan_socket_set_status(RSI_ERROR_ENOBUFS, sockID);
-      // Release mutex lock
-      RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
-#ifdef RSI_WITH_OS
-      rsi_set_os_errno(RSI_ERROR_ENOBUFS);
+  return (int32_t)i;
+}
 #endif
-      return RSI_SOCK_ERROR;
-    }
 
-    // Calculate buffers required for sending this length
-    buffers_required = calculate_buffers_required(sock_info->sock_type, msgLength);
+/*==============================================*/
+/**
+ * @brief       Send several messages, each as by \ref rsi_sendmsg(). On a UDP socket each message is one datagram.
+ *              This is a blocking API.
+ * @pre         \ref rsi_socket() API needs to be called before this API.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msgvec         - Messages to send, msg_len of each message is set to the number of bytes sent
+ * @param[in]   vlen           - Number of messages
+ * @param[in]   flags          - MSG_DONTWAIT to return RSI_ERROR_EAGAIN instead of waiting
+ * @return      Positive Value - Success, returns the number of messages sent; sending stops at the first
+ *                               message that fails \n
+ *              Negative Value - Failure, no message was sent
+ * @note        If RSI_SOCKET_TX_BATCH is set, datagrams on a UDP socket are queued to module together and the API
+ *              waits once for all of them, instead of once per datagram. Datagrams after a failed one may still
+ *              have been sent in that case. With MSG_DONTWAIT or SO_NONBLOCK, datagrams are only queued, and
+ *              other sends on the socket fail with RSI_ERROR_EAGAIN till they are written.
+ *
+ */
+int32_t rsi_sendmmsg(int32_t sockID, struct rsi_mmsghdr *msgvec, uint32_t vlen, int32_t flags)
+{
+  int32_t status;
+  uint32_t i;
 
-    if (buffers_required > sock_info->current_available_buffer_count) {
-      // Calculate length can be sent with available buffers
-      msgLength                                 = global_cb_p->rom_apis_p->ROM_WL_calculate_length_to_send(global_cb_p,
-                                                                           sock_info->sock_type,
-                                                                           sock_info->current_available_buffer_count);
-      sock_info->current_available_buffer_count = 0;
-    } else {
-      // Subtract buffers required to send this packet
-      if (sock_info->current_available_buffer_count > buffers_required) {
-        sock_info->current_available_buffer_count -= buffers_required;
-      } else {
-        sock_info->current_available_buffer_count = 0;
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return RSI_SOCK_ERROR;
+  }
+
+  if ((msgvec == NULL) && (vlen != 0)) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EINVAL);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+
+  for (i = 0; i < vlen; i++) {
+#if RSI_SOCKET_TX_BATCH
+    // UDP socket is created in module by its first send, later datagrams can be batched
+    if (((global_cb_p->rsi_socket_pool[sockID].sock_type & 0xF) == SOCK_DGRAM)
+        && (global_cb_p->rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_CONNECTED)) {
+      status = rsi_sendmmsg_batch(sockID, &msgvec[i], vlen - i, flags);
+      if (status < 0) {
+        return (i == 0) ? status : (int32_t)i;
       }
+      return (int32_t)(i + status);
     }
-
-    // Set expected response based on the callback
-    if (data_transfer_complete_handler != NULL) {
-#ifdef RSI_UART_INTERFACE
-      rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_UART_DATA_ACK;
-#else
-      rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_ASYNCHRONOUS;
 #endif
-    } else {
-      rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_TCP_ACK_INDICATION;
+    status = rsi_sendmsg(sockID, &msgvec[i].msg_hdr, flags);
+    if (status < 0) {
+      // Error of socket is kept for application if no message was sent
+      return (i == 0) ? status : (int32_t)i;
     }
-  } else {
-#ifdef RSI_UART_INTERFACE
-    rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_UART_DATA_ACK;
-#else
-    rsi_driver_cb->wlan_cb->expected_response = RSI_WLAN_RSP_ASYNCHRONOUS;
+    msgvec[i].msg_len = (uint32_t)status;
+  }
+  return (int32_t)vlen;
+}
+
+/*==============================================*/
+/**
+ * @brief       Receive data scattered into a list of buffers. Received data is copied straight into the buffers,
+ *              in order, so a header and a payload can be received into separate buffers. This is a blocking API.
+ * @pre         Same as \ref rsi_recvfrom().
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   msg            - Message, msg_iov and msg_iovlen give the buffers. If msg_name is not NULL, address of
+ *                               remote peer is copied to it and msg_namelen is updated. msg_control is not supported.
+ * @param[in]   flags          - Same as in \ref rsi_recvfrom()
+ * @return      Positive Value - Success, returns the number of bytes received successfully \n
+ *              Negative Value - Failure \n
+ *              zero           - Socket close error
+ *
+ */
+int32_t rsi_recvmsg(int32_t sockID, struct rsi_msghdr *msg, int32_t flags)
+{
+  int32_t status;
+  int32_t length      = 0;
+  int32_t fromAddrLen = 0;
+  int8_t *buffer      = NULL;
+  uint32_t i;
+  rsi_socket_info_non_rom_t *sock_info_non_rom;
+
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return RSI_SOCK_ERROR;
+  }
+
+  if (msg != NULL) {
+    for (i = 0; (msg->msg_iov != NULL) && (i < msg->msg_iovlen); i++) {
+      if ((buffer == NULL) && msg->msg_iov[i].iov_len) {
+        buffer = (int8_t *)msg->msg_iov[i].iov_base;
+      }
+      length += (int32_t)msg->msg_iov[i].iov_len;
+    }
+  }
+  if (buffer == NULL) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_EINVAL);
 #endif
+    return RSI_SOCK_ERROR;
   }
 
-  // Send data send command
-  status = rsi_driver_send_data(sockID, (uint8_t *)msg, msgLength, destAddr);
+  if (msg->msg_name != NULL) {
+    fromAddrLen = (int32_t)msg->msg_namelen;
+  }
 
-  // Release mutex lock
-  RSI_MUTEX_UNLOCK(&rsi_driver_cb->wlan_cb->wlan_mutex);
+  // Buffer only marks the receive as pending, data is copied to the list by rsi_socket_recv_copy()
+  sock_info_non_rom                  = &rsi_socket_pool_non_rom[sockID];
+  sock_info_non_rom->recv_iov        = msg->msg_iov;
+  sock_info_non_rom->recv_iovlen     = msg->msg_iovlen;
+  sock_info_non_rom->recv_iov_offset = 0;
 
-  if (status == RSI_SUCCESS) {
-    return msgLength;
-  } else {
+  status = rsi_recvfrom(sockID, buffer, length, flags, (struct rsi_sockaddr *)msg->msg_name, &fromAddrLen);
+
+  sock_info_non_rom->recv_iov = NULL;
+
+  if (msg->msg_name != NULL) {
+    msg->msg_namelen = (rsi_socklen_t)fromAddrLen;
+  }
+  msg->msg_flags = 0;
+
+  return status;
+}
+/** @} */
+
+/*==============================================*/
+/**
+ * @brief       Set a receive packet handler on an asynchronous socket. Received data packets are handed over to
+ *              the handler instead of the socket receive callback, without copying. Data is at pkt->data + offset.
+ *              Application owns the packet till it returns it using \ref rsi_recv_pkt_release(). One receive
+ *              packet is never loaned, for command responses; data received while all others are held by
+ *              application is given to the socket receive callback instead, and dropped if there is none.
+ * @pre         \ref rsi_socket_async() API needs to be called before this API. RSI_DRIVER_RX_POOL_PKT_COUNT must
+ *              be 2 or more, so a packet held by application does not block command responses; otherwise the
+ *              API fails with RSI_ERROR_ENOBUFS.
+ * @param[in]   sockID         - Socket descriptor ID
+ * @param[in]   handler        - Receive packet handler, NULL to go back to socket receive callback
+ * @return      Zero           - Success \n
+ *              Negative Value - Failure
+ *
+ */
+int32_t rsi_socket_set_recv_pkt_handler(int32_t sockID,
+                                        void (*handler)(int32_t sockID,
+                                                        rsi_pkt_t *pkt,
+                                                        uint16_t offset,
+                                                        uint16_t length))
+{
+  rsi_socket_info_t *rsi_socket_pool = global_cb_p->rsi_socket_pool;
+
+  // If sockID is not in available range
+  if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
+    return RSI_SOCK_ERROR;
+  }
+
+#if ((defined RSI_SDIO_INTERFACE) && (!defined LINUX_PLATFORM))
+  // Received frames are not read into RX packets in this configuration
+  UNUSED_PARAMETER(handler);
+  UNUSED_PARAMETER(rsi_socket_pool);
+  rsi_wlan_socket_set_status(RSI_ERROR_EOPNOTSUPP, sockID);
+  return RSI_SOCK_ERROR;
+#else
+  if ((rsi_socket_pool[sockID].sock_state == RSI_SOCKET_STATE_INIT)
+      || (rsi_socket_pool[sockID].sock_bitmap & RSI_SOCKET_FEAT_SYNCHRONOUS)) {
+    // Set error
+    rsi_wlan_socket_set_status(RSI_ERROR_EINVAL, sockID);
 #ifdef RSI_WITH_OS
-    status = rsi_get_error(sockID);
-    rsi_set_os_errno(status);
+    rsi_set_os_errno(RSI_ERROR_EINVAL);
+#endif
+    return RSI_SOCK_ERROR;
+  }
+  if ((handler != NULL) && (rsi_driver_cb->rx_pool.size < 2)) {
+    // Only receive packet would be held by application, with command responses waiting behind it
+    rsi_wlan_socket_set_status(RSI_ERROR_ENOBUFS, sockID);
+#ifdef RSI_WITH_OS
+    rsi_set_os_errno(RSI_ERROR_ENOBUFS);
 #endif
     return RSI_SOCK_ERROR;
   }
+
+  rsi_socket_pool_non_rom[sockID].recv_pkt_handler = handler;
+
+  return RSI_SUCCESS;
+#endif
 }
+
 /*==============================================*/
 /**
  * @brief       Clear socket information
@@ -3814,6 +6206,8 @@ void rsi_clear_sockets_non_rom(int32_t sockID)
 
   if (sockID == RSI_CLEAR_ALL_SOCKETS) {
     for (i = 0; i < NUMBER_OF_SOCKETS; i++) {
+      // Release packet reserved for zero copy send
+      rsi_send_release(i);
       // Memset socket info
       memset(&rsi_socket_pool[i], 0, sizeof(rsi_socket_info_t));
     }
@@ -3834,6 +6228,8 @@ void rsi_clear_sockets_non_rom(int32_t sockID)
     if (sockID < 0 || sockID >= NUMBER_OF_SOCKETS) {
       return;
     }
+    // Release packet reserved for zero copy send
+    rsi_send_release(sockID);
     if ((rsi_socket_pool[sockID].ltcp_socket_type == RSI_LTCP_PRIMARY_SOCKET)) {
       if (rsi_socket_pool[sockID].backlog_current_count) {
         rsi_socket_pool[sockID].sock_state = RSI_SOCKET_STATE_LISTEN;
@@ -0,0 +1,665 @@
+/*******************************************************************************
+* @file  rsi_os_wrapper.c
+* @brief
+*******************************************************************************
+* # License
+* <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+*******************************************************************************
+*
+* The licensor of this software is Silicon Laboratories Inc. Your use of this
+* software is governed by the terms of Silicon Labs Master Software License
+* Agreement (MSLA) available at
+* www.silabs.com/about-us/legal/master-software-license-agreement. This
+* software is distributed to you in Source Code format and is governed by the
+* sections of the MSLA applicable to Source Code.
+*
+******************************************************************************/
+
+#include <rsi_driver.h>
+#ifdef RSI_WITH_OS
+/**
+ * Include files
+ * */
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include "rsi_wlan_non_rom.h"
+extern rsi_socket_info_non_rom_t *rsi_socket_pool_non_rom;
+
+// Number of semaphores and mutexes that can exist at a time
+#ifndef RSI_PTHREAD_MAX_SYNC_OBJECTS
+#define RSI_PTHREAD_MAX_SYNC_OBJECTS 256
+#endif
+
+// Semaphore/mutex object, handles are index + 1 so that 0 stays "not created"
+typedef struct rsi_pthread_sync_s {
+  uint8_t in_use;
+  uint8_t count;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+} rsi_pthread_sync_t;
+
+static rsi_pthread_sync_t rsi_pthread_sync[RSI_PTHREAD_MAX_SYNC_OBJECTS];
+
+// Protects allocation of sync objects
+static pthread_mutex_t rsi_pthread_sync_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Critical section, recursive since driver nests critical sections
+static pthread_mutex_t rsi_pthread_critical = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/*==============================================*/
+/**
+ * @fn          static rsi_pthread_sync_t *rsi_pthread_sync_get(uint32_t handle)
+ * @brief       Get sync object of a handle.
+ * @param[in]   handle - Semaphore/mutex handle
+ * @return      Sync object, NULL if handle is not created
+ */
+static rsi_pthread_sync_t *rsi_pthread_sync_get(uint32_t handle)
+{
+  if ((handle == 0) || (handle > RSI_PTHREAD_MAX_SYNC_OBJECTS) || !rsi_pthread_sync[handle - 1].in_use) {
+    return NULL;
+  }
+  return &rsi_pthread_sync[handle - 1];
+}
+
+/*==============================================*/
+/**
+ * @fn          static rsi_error_t rsi_pthread_sync_create(uint32_t *handle, uint8_t count)
+ * @brief       Create a binary sync object.
+ * @param[out]  handle - Created handle
+ * @param[in]   count  - Initial count, 0 or 1
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ */
+static rsi_error_t rsi_pthread_sync_create(uint32_t *handle, uint8_t count)
+{
+  pthread_condattr_t attr;
+  rsi_pthread_sync_t *sync;
+  uint32_t i;
+
+  if (handle == NULL) {
+    return RSI_ERROR_IN_OS_OPERATION;
+  }
+
+  pthread_mutex_lock(&rsi_pthread_sync_lock);
+  for (i = 0; i < RSI_PTHREAD_MAX_SYNC_OBJECTS; i++) {
+    if (!rsi_pthread_sync[i].in_use) {
+      break;
+    }
+  }
+  if (i == RSI_PTHREAD_MAX_SYNC_OBJECTS) {
+    pthread_mutex_unlock(&rsi_pthread_sync_lock);
+    return RSI_ERROR_IN_OS_OPERATION;
+  }
+  sync         = &rsi_pthread_sync[i];
+  sync->in_use = 1;
+  sync->count  = count;
+  pthread_mutex_init(&sync->lock, NULL);
+
+  // Timed waits are measured on monotonic clock
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&sync->cond, &attr);
+  pthread_condattr_destroy(&attr);
+  pthread_mutex_unlock(&rsi_pthread_sync_lock);
+
+  *handle = i + 1;
+  return RSI_ERROR_NONE;
+}
+
+/*==============================================*/
+/**
+ * @fn          static rsi_error_t rsi_pthread_sync_destroy(uint32_t *handle)
+ * @brief       Destroy a sync object.
+ * @param[in]   handle - Handle pointer
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ */
+static rsi_error_t rsi_pthread_sync_destroy(uint32_t *handle)
+{
+  rsi_pthread_sync_t *sync;
+
+  if (handle == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  sync = rsi_pthread_sync_get(*handle);
+  if (sync == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  pthread_mutex_lock(&rsi_pthread_sync_lock);
+  pthread_cond_destroy(&sync->cond);
+  pthread_mutex_destroy(&sync->lock);
+  sync->in_use = 0;
+  pthread_mutex_unlock(&rsi_pthread_sync_lock);
+
+  *handle = 0;
+  return RSI_ERROR_NONE;
+}
+
+/*==============================================*/
+/**
+ * @fn          static rsi_error_t rsi_pthread_sync_take(uint32_t handle, uint32_t timeout_ms)
+ * @brief       Take a sync object, waiting for it to be given.
+ * @param[in]   handle     - Semaphore/mutex handle
+ * @param[in]   timeout_ms - Maximum time to wait, 0 waits forever
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ */
+static rsi_error_t rsi_pthread_sync_take(uint32_t handle, uint32_t timeout_ms)
+{
+  rsi_pthread_sync_t *sync = rsi_pthread_sync_get(handle);
+  struct timespec deadline;
+  int ret = 0;
+
+  if (sync == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  if (timeout_ms) {
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+  }
+
+  pthread_mutex_lock(&sync->lock);
+  while (!sync->count && (ret != ETIMEDOUT)) {
+    if (timeout_ms) {
+      ret = pthread_cond_timedwait(&sync->cond, &sync->lock, &deadline);
+    } else {
+      pthread_cond_wait(&sync->cond, &sync->lock);
+    }
+  }
+  if (!sync->count) {
+    pthread_mutex_unlock(&sync->lock);
+    return RSI_ERROR_IN_OS_OPERATION;
+  }
+  sync->count = 0;
+  pthread_mutex_unlock(&sync->lock);
+
+  return RSI_ERROR_NONE;
+}
+
+/*==============================================*/
+/**
+ * @fn          static rsi_error_t rsi_pthread_sync_give(uint32_t handle)
+ * @brief       Give a sync object, count saturates at 1 like a FreeRTOS binary semaphore.
+ * @param[in]   handle - Semaphore/mutex handle
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ */
+static rsi_error_t rsi_pthread_sync_give(uint32_t handle)
+{
+  rsi_pthread_sync_t *sync = rsi_pthread_sync_get(handle);
+
+  if (sync == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  pthread_mutex_lock(&sync->lock);
+  sync->count = 1;
+  pthread_cond_signal(&sync->cond);
+  pthread_mutex_unlock(&sync->lock);
+
+  return RSI_ERROR_NONE;
+}
+
+/** @addtogroup RTOS
+* @{
+*/
+/*==============================================*/
+/**
+ * @fn          rsi_reg_flags_t rsi_critical_section_entry()
+ * @brief       Enter critical section, serializing against other threads.
+ * @param[in]   None
+ * @return      flags - Always 0
+ *
+ */
+rsi_reg_flags_t rsi_critical_section_entry()
+{
+  pthread_mutex_lock(&rsi_pthread_critical);
+  return 0;
+}
+
+/*==============================================*/
+/**
+ * @fn         rsi_critical_section_exit(rsi_reg_flags_t xflags)
+ * @brief      Exit critical section.
+ * @param[in]  xflags - Flags returned on entry
+ * @return     Void
+ *
+ */
+void rsi_critical_section_exit(rsi_reg_flags_t xflags)
+{
+  //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(xflags);
+  pthread_mutex_unlock(&rsi_pthread_critical);
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_mutex_create(rsi_mutex_handle_t *mutex)
+ * @brief        Create and initialize the mutex
+ * @param[in]    mutex - Mutex handle pointer
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_mutex_create(rsi_mutex_handle_t *mutex)
+{
+  // Mutex starts unlocked
+  return rsi_pthread_sync_create(mutex, 1);
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_mutex_lock(volatile rsi_mutex_handle_t *mutex)
+ * @brief        Take the mutex
+ * @param[in]    mutex - Mutex handle pointer
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_mutex_lock(volatile rsi_mutex_handle_t *mutex)
+{
+  if (mutex == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  return rsi_pthread_sync_take(*mutex, 0);
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_mutex_unlock(volatile rsi_mutex_handle_t *mutex)
+ * @brief        Give the mutex
+ * @param[in]    mutex - Mutex handle pointer
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_mutex_unlock(volatile rsi_mutex_handle_t *mutex)
+{
+  if (mutex == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  return rsi_pthread_sync_give(*mutex);
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_mutex_destroy(rsi_mutex_handle_t *mutex)
+ * @brief        Destroy the mutex
+ * @param[in]    mutex - Mutex handle pointer
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_mutex_destroy(rsi_mutex_handle_t *mutex)
+{
+  return rsi_pthread_sync_destroy(mutex);
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_semaphore_create(rsi_semaphore_handle_t *semaphore,uint32_t count)
+ * @brief        Create and initialize the semaphore instance
+ * @param[in]    semaphore - Semaphore handle pointer
+ * @param[in]    count - Resource count, semaphore is binary so any non zero count makes it available
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_semaphore_create(rsi_semaphore_handle_t *semaphore, uint32_t count)
+{
+  return rsi_pthread_sync_create(semaphore, (count ? 1 : 0));
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_semaphore_destroy(rsi_semaphore_handle_t *semaphore)
+ * @brief        Destroy the semaphore instance
+ * @param[in]    semaphore - Semaphore handle pointer
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ */
+rsi_error_t rsi_semaphore_destroy(rsi_semaphore_handle_t *semaphore)
+{
+  return rsi_pthread_sync_destroy(semaphore);
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_semaphore_check_and_destroy(rsi_semaphore_handle_t *semaphore)
+ * @brief        Destroy the semaphore instance if it exists
+ * @param[in]    semaphore - Semaphore handle pointer
+ * @return       0 - Success
+ */
+rsi_error_t rsi_semaphore_check_and_destroy(rsi_semaphore_handle_t *semaphore)
+{
+  if (semaphore == NULL || rsi_pthread_sync_get(*semaphore) == NULL) {
+    return RSI_ERROR_NONE; // returning success since semaphore does not exists
+  }
+  return rsi_pthread_sync_destroy(semaphore);
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t rsi_semaphore_wait(rsi_semaphore_handle_t *semaphore, uint32_t timeout_ms )
+ * @brief       Wireless library to acquire or wait for semaphore.
+ * @param[in]   semaphore - Semaphore handle pointer
+ * @param[in]   time_ms - Maximum time to wait to acquire semaphore. If timeout_ms is 0 then wait
+                till acquire semaphore.
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_semaphore_wait(rsi_semaphore_handle_t *semaphore, uint32_t timeout_ms)
+{
+  if (semaphore == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  return rsi_pthread_sync_take(*semaphore, timeout_ms);
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t rsi_semaphore_post(rsi_semaphore_handle_t *semaphore)
+ * @brief       Wireless library to release semaphore, which was acquired.
+ * @param[in]   semaphore - Semaphore handle pointer
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_semaphore_post(rsi_semaphore_handle_t *semaphore)
+{
+  if (semaphore == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  return rsi_pthread_sync_give(*semaphore);
+}
+
+/*====================================================*/
+/**
+ * @fn          rsi_error_t rsi_semaphore_post_from_isr(rsi_semaphore_handle_t *semaphore)
+ * @brief       Wireless library to release semaphore, which was acquired. Simulated interrupts
+ *              run in thread context, so this is the same as rsi_semaphore_post.
+ * @param[in]   semphore - Semaphore handle pointer
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_semaphore_post_from_isr(rsi_semaphore_handle_t *semaphore)
+{
+  return rsi_semaphore_post(semaphore);
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t rsi_semaphore_reset(rsi_semaphore_handle_t *semaphore)
+ * @brief       Used by Wireless Library to reset the semaphore
+ * @param[in]   semphore - Semaphore handle pointer
+ * @return      0              - Success \n
+ *              Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_semaphore_reset(rsi_semaphore_handle_t *semaphore)
+{
+  rsi_pthread_sync_t *sync;
+
+  if (semaphore == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  sync = rsi_pthread_sync_get(*semaphore);
+  if (sync == NULL) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  pthread_mutex_lock(&sync->lock);
+  sync->count = 0;
+  pthread_mutex_unlock(&sync->lock);
+
+  return RSI_ERROR_NONE;
+}
+
+/*==============================================*/
+/**
+ * @fn           rsi_error_t rsi_task_create( rsi_task_function_t task_function,uint8_t *task_name,
+                 uint32_t stack_size, void *parameters,
+                 uint32_t task_priority,rsi_task_handle_t  *task_handle)
+ * @brief        Wireless Library to create platform specific OS task/thread.
+ * @param[in]    task_function - Pointer to function to be executed by created thread. Prototype of the function
+ * @param[in]    task_name     - Name of the created task
+ * @param[in]    stack_size    - Stack size given to the created task, default thread stack is used
+ * @param[in]    parameters    - Pointer to the parameters to be passed to task function
+ * @param[in]    task_priority - task priority, ignored since threads share default scheduling policy
+ * @param[in]    task_handle   - task handle/instance created
+ * @return       0              - Success \n
+ *               Negative Value - Failure
+ *
+ */
+rsi_error_t rsi_task_create(rsi_task_function_t task_function,
+                            uint8_t *task_name,
+                            uint32_t stack_size,
+                            void *parameters,
+                            uint32_t task_priority,
+                            rsi_task_handle_t *task_handle)
+{
+  pthread_t thread;
+
+  UNUSED_PARAMETER(stack_size);    //This statement is added only to resolve compilation warning, value is unchanged
+  UNUSED_PARAMETER(task_priority); //This statement is added only to resolve compilation warning, value is unchanged
+
+  if (pthread_create(&thread, NULL, (void *(*)(void *))task_function, parameters)) {
+    return RSI_ERROR_IN_OS_OPERATION;
+  }
+  pthread_detach(thread);
+  if (task_name != NULL) {
+    // Thread names are limited to 16 bytes, longer names are left unset
+    pthread_setname_np(thread, (const char *)task_name);
+  }
+  if (task_handle != NULL) {
+    *task_handle = (rsi_task_handle_t)thread;
+  }
+
+  return RSI_ERROR_NONE;
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_task_destroy(rsi_task_handle_t *task_handle)
+ * @brief       Delete the task created
+ * @param[in]   task_handle - Task handle/instance to be deleted, NULL deletes calling task
+ * @return      void
+ *
+ */
+void rsi_task_destroy(rsi_task_handle_t *task_handle)
+{
+  if ((task_handle == NULL) || pthread_equal((pthread_t)task_handle, pthread_self())) {
+    pthread_exit(NULL);
+  }
+  pthread_cancel((pthread_t)task_handle);
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_os_task_delay(uint32_t timeout_ms)
+ * @brief       Induce required delay in milli seconds
+ * @param[in]   timeout_ms - Expected delay in milli seconds
+ * @return      void
+ */
+void rsi_os_task_delay(uint32_t timeout_ms)
+{
+  struct timespec delay;
+
+  delay.tv_sec  = timeout_ms / 1000;
+  delay.tv_nsec = (timeout_ms % 1000) * 1000000L;
+  while (nanosleep(&delay, &delay) && (errno == EINTR))
+    ;
+}
+
+/*==============================================*/
+/**
+ * @fn           void rsi_start_os_scheduler()
+ * @brief        Schedule the tasks created. Threads already run, so calling thread just leaves
+ *               and process lives on until a task exits it.
+ * @param[in]    None
+ * @return       void
+ */
+void rsi_start_os_scheduler()
+{
+  pthread_exit(NULL);
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_set_os_errno(int32_t error)
+ * @brief       Sets the os error .
+ * @param[in]   error - Error
+ * @return      void
+ */
+void rsi_set_os_errno(int32_t error)
+{
+  UNUSED_PARAMETER(error); //This statement is added only to resolve compilation warning, value is unchanged
+}
+
+#ifdef RSI_WLAN_ENABLE
+
+/*==============================================*/
+/**
+ * @fn          int32_t rsi_get_error(int32_t sockID)
+ * @brief       Return wlan status
+ * @param[in]   sockID - Socket Id
+ * @return      wlan status
+ */
+/// @private
+int32_t rsi_get_error(int32_t sockID)
+{
+  if (rsi_socket_pool_non_rom[sockID].socket_status == 0xFF87
+      || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB38) {
+    return RSI_ERROR_ECONNREFUSED;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0x00D2) {
+    return RSI_ERROR_ECONNABORTED;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xFF6C
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xFF6A
+             || rsi_socket_pool_non_rom[sockID].socket_status == RSI_ERROR_RESPONSE_TIMEOUT
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBBD6) {
+    return RSI_ERROR_ETIMEDOUT;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0x0021
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xFF82
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xFF74
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB27
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xFF80
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0x00D1) {
+    return RSI_ERROR_EACCES;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0x00D3
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xFFFE) {
+    return RSI_ERROR_EPERM;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xFF7E
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBBED
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0x003E
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0x0030
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB3E) {
+    return RSI_ERROR_EMSGSIZE;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xFF86) {
+    return RSI_ERROR_EBADF;
+  } else if ((rsi_socket_pool_non_rom[sockID].socket_status == 0x0015)
+             || (rsi_socket_pool_non_rom[sockID].socket_status == 0x0025)) {
+    return RSI_ERROR_EAGAIN;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xBB22
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB42) {
+    return RSI_ERROR_EISCONN;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xFFFF
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB50) {
+    return RSI_ERROR_ENOTCONN;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xBB33
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB23
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB45
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB46
+             || rsi_socket_pool_non_rom[sockID].socket_status == 0xBB50) {
+    return RSI_ERROR_EADDRINUSE;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == 0xBB36) {
+    return RSI_ERROR_ENOTSOCK;
+  } else if (rsi_socket_pool_non_rom[sockID].socket_status == RSI_ERROR_PKT_ALLOCATION_FAILURE) {
+    return RSI_ERROR_ENOMEM;
+  } else
+    return RSI_SOCK_ERROR;
+}
+
+#endif
+
+/*==============================================*/
+/**
+ * @fn          void *rsi_malloc (uint32_t size)
+ * @brief       Allocate memory from the process heap
+ * @param[in]   size - required bytes in size
+ * @return      void
+ */
+void *rsi_malloc(uint32_t size)
+{
+  if (size == 0) {
+    return NULL;
+  } else {
+    return malloc(size);
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_free (void *ptr)
+ * @brief       Free the memory pointed by 'ptr'
+ * @param[in]   ptr - starting address of the memory to be freed
+ * @return      void
+ */
+void rsi_free(void *ptr)
+{
+  free(ptr);
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_vport_enter_critical(void)
+ * @brief       Enter into critical section
+ * @param[in]   void
+ * @return      void
+ */
+void rsi_vport_enter_critical(void)
+{
+  pthread_mutex_lock(&rsi_pthread_critical);
+}
+
+/*==============================================*/
+/**
+ * @fn         void rsi_vport_exit_critical(void)
+ * @brief       Exit from critical section
+ * @param[in]   void
+ * @return      void
+ */
+void rsi_vport_exit_critical(void)
+{
+  pthread_mutex_unlock(&rsi_pthread_critical);
+}
+
+/*==============================================*/
+/**
+ * @fn          void rsi_task_suspend(rsi_task_handle_t *task_handle)
+ * @brief       Suspend a task. Threads cannot be suspended from outside, so only the calling
+ *              task is supported and it sleeps for good.
+ * @param[in]   task_handle - Task handle to be suspended
+ * @return      void
+ */
+void rsi_task_suspend(rsi_task_handle_t *task_handle)
+{
+  if ((task_handle == NULL) || pthread_equal((pthread_t)task_handle, pthread_self())) {
+    for (;;) {
+      pause();
+    }
+  }
+}
+#endif
+/** @} */
@@ -139,6 +139,15 @@ freertos_SOURCES = $(RSI_SDK_PATH)/sapi/rtos/freertos_wrapper/rsi_os_wrapper.c \
                    $(RSI_SDK_PATH)/third_party/freertos/portable/MemMang/heap_4.c
 endif
 
+# Platforms may replace the device interface, SPI by default
+ifndef DEVICE_INTERFACE_SOURCES
+DEVICE_INTERFACE_SOURCES = $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_frame_rd_wr.c \
+                           $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_functs.c \
+                           $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_iface_init.c \
+                           $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_mem_rd_wr.c \
+                           $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_reg_rd_wr.c
+endif
+
 COMMON_SOURCES = $(RSI_SDK_PATH)/sapi/common/rsi_common_apis.c \
                  $(RSI_SDK_PATH)/sapi/common/rsi_device_init_apis.c \
                  $(RSI_SDK_PATH)/sapi/common/rsi_apis_rom.c \
@@ -153,11 +162,7 @@ COMMON_SOURCES = $(RSI_SDK_PATH)/sapi/common/rsi_common_apis.c \
                  $(RSI_SDK_PATH)/sapi/driver/rsi_scheduler.c \
                  $(RSI_SDK_PATH)/sapi/driver/rsi_utils.c \
                  $(RSI_SDK_PATH)/sapi/driver/rsi_timer.c \
-                 $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_frame_rd_wr.c \
-                 $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_functs.c \
-                 $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_iface_init.c \
-                 $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_mem_rd_wr.c \
-                 $(RSI_SDK_PATH)/sapi/driver/device_interface/spi/rsi_spi_reg_rd_wr.c \
+                 $(DEVICE_INTERFACE_SOURCES) \
                  $(RSI_SDK_PATH)/sapi/driver/rsi_iap.c  \
                  $(RSI_SDK_PATH)/sapi/driver/rsi_common.c  \
 
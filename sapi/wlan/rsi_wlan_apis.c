@@ -5042,7 +5042,7 @@ int32_t rsi_wlan_send_data(uint8_t *buffer, uint32_t length)
   }
 
   // Allocate packet to send data
-  pkt = rsi_pkt_alloc(&rsi_driver_cb->wlan_cb->wlan_tx_pool);
+  pkt = rsi_pkt_alloc(rsi_wlan_get_data_tx_pool());
 
   if (pkt == NULL) {
     return RSI_ERROR_PKT_ALLOCATION_FAILURE;
@@ -7684,13 +7684,11 @@ int32_t rsi_send_per_packet(tx_per_params_t *per_params, uint32_t pkt_size)
   int32_t status = 0;
 
   uint8_t *data = NULL;
-  // Get WLAN CB structure pointer
-  rsi_wlan_cb_t *wlan_cb = rsi_driver_cb->wlan_cb;
 
   status = rsi_check_and_update_cmd_state(WLAN_CMD, IN_USE);
   if (status == RSI_SUCCESS) {
     // Allocate command buffer from WLAN pool
-    pkt = rsi_pkt_alloc(&wlan_cb->wlan_tx_pool);
+    pkt = rsi_pkt_alloc(rsi_wlan_get_data_tx_pool());
 
     // If allocation of packet fails
     if (pkt == NULL) {
@@ -7844,13 +7842,11 @@ uint32_t rsi_prepare_per_pkt(tx_per_params_t *per_params, uint16_t length)
   uint8_t offset = 0, min_len = 0;
   uint32_t rate_flags, greenfield, ch_bw, i = 0;
   uint32_t *frame_desc, temp_word;
-  // Get WLAN CB struct pointer
-  rsi_wlan_cb_t *wlan_cb = rsi_driver_cb->wlan_cb;
 
   status = rsi_check_and_update_cmd_state(WLAN_CMD, IN_USE);
   if (status == RSI_SUCCESS) {
     // Allocate command buffer from WLAN pool
-    pkt = rsi_pkt_alloc(&wlan_cb->wlan_tx_pool);
+    pkt = rsi_pkt_alloc(rsi_wlan_get_data_tx_pool());
 
     // If allocation of packet fails
     if (pkt == NULL) {
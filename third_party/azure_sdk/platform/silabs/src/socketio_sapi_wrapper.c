@@ -285,6 +285,13 @@ static int initiate_socket_connection(SOCKET_IO_INSTANCE *socket_io_instance)
       } else {
         //! Async connect will return -1.
         result = 0;
+        //! Send and receive in dowork return RSI_ERROR_EAGAIN instead of waiting
+        uint32_t non_blocking = 1;
+        (void)rsi_setsockopt(socket_io_instance->socket,
+                             SOL_SOCKET,
+                             SO_NONBLOCK,
+                             &non_blocking,
+                             sizeof(non_blocking));
         if (socket_io_instance->on_io_open_complete != NULL) {
           socket_io_instance->on_io_open_complete(socket_io_instance->on_io_open_complete_context,
                                                   IO_OPEN_OK);
@@ -568,7 +575,8 @@ int socketio_send(CONCRETE_IO_HANDLE socket_io,
       } else {
         int32_t send_result = rsi_send(socket_io_instance->socket, buffer, size, MSG_NOSIGNAL);
         if ((int32_t)send_result != size) {
-          if ((int32_t)send_result == SOCKET_SEND_FAILURE) {
+          if (((int32_t)send_result == SOCKET_SEND_FAILURE)
+              && (rsi_wlan_socket_get_status(socket_io_instance->socket) != RSI_ERROR_EAGAIN)) {
             LogError("Failure: sending socket failed. errno=%d (%s).", errno, strerror(errno));
             result = MU_FAILURE;
           } else {
@@ -621,6 +629,10 @@ void socketio_dowork(CONCRETE_IO_HANDLE socket_io)
           rsi_send(socket_io_instance->socket, (const int8_t *)pending_socket_io->bytes, pending_socket_io->size, MSG_NOSIGNAL);
         if ((send_result < 0) || ((uint32_t)send_result != pending_socket_io->size)) {
           if ((int32_t)send_result == INVALID_SOCKET) {
+            if (rsi_wlan_socket_get_status(socket_io_instance->socket) == RSI_ERROR_EAGAIN) {
+              //! No module buffers, try again on next dowork
+              break;
+            }
             //! need to handle 
           } else {
             //! Simply wait until next dowork 
@@ -661,6 +673,8 @@ void socketio_dowork(CONCRETE_IO_HANDLE socket_io)
           } else if (received == 0) {
             //! Do not log error here due to this is probably the socket being closed on the other end
             indicate_error(socket_io_instance);
+          } else if (rsi_wlan_socket_get_status(socket_io_instance->socket) == RSI_ERROR_EAGAIN) {
+            //! No data available now
           } else if (received < 0) {
             LogError("Socketio_Failure: Receiving data from endpoint: errno=%d.", errno);
             indicate_error(socket_io_instance);